@@ -0,0 +1,189 @@
+// Microbenchmarks for the watch's timezone engine and render path, built on the host
+// against the stub SDK. The app's main.c is compiled into this file (APP_MAIN is set
+// by the Makefile) so its static functions can be called directly.
+//
+// Usage: bench [ticks]   (default 5000000 simulated seconds for the tick benchmarks)
+#include <inttypes.h>
+
+#include "fake_pebble.h"
+
+#define main app_main
+#include APP_MAIN
+#undef main
+
+#define SAMPLE_COUNT 4096
+
+static volatile int s_sink;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void report(const char *name, uint64_t calls, uint64_t elapsed_ns) {
+  printf("%-34s %10" PRIu64 " %10.1f %10.3f %10.3f %10.3f %10.3f\n", name, calls,
+         (double)elapsed_ns / calls,
+         (double)fake_counters.allocations / calls,
+         (double)fake_counters.text_updates / calls,
+         (double)fake_counters.dirty_marks / calls,
+         (double)fake_counters.resource_reads / calls);
+}
+
+// Runs body `calls` times with the counters reset, then prints one result line
+#define BENCH(name, calls, ...)                      \
+  do {                                               \
+    uint64_t n_ = (calls);                           \
+    fake_counters_reset();                           \
+    uint64_t start_ = now_ns();                      \
+    for (uint64_t i = 0; i < n_; i++) {              \
+      __VA_ARGS__;                                   \
+    }                                                \
+    report((name), n_, now_ns() - start_);           \
+  } while (0)
+
+// Units that changed between two local times, as the tick service reports them
+static TimeUnits units_changed(const struct tm *prev, const struct tm *now) {
+  TimeUnits units = SECOND_UNIT;
+  if (now->tm_min != prev->tm_min) units |= MINUTE_UNIT;
+  if (now->tm_hour != prev->tm_hour) units |= HOUR_UNIT;
+  if (now->tm_mday != prev->tm_mday) units |= DAY_UNIT;
+  if (now->tm_mon != prev->tm_mon) units |= MONTH_UNIT;
+  if (now->tm_year != prev->tm_year) units |= YEAR_UNIT;
+  return units;
+}
+
+// Delivers `ticks` ticks `step` seconds apart. Local times are computed in untimed
+// batches (the firmware does that work for the app), so only the handler is timed.
+static void bench_ticks(const char *name, uint64_t ticks, int step) {
+  static struct {
+    time_t utc;
+    struct tm local;
+    TimeUnits units;
+  } batch[SAMPLE_COUNT];
+  time_t start = fake_clock_now();
+  time_t utc = start;
+  struct tm prev = *localtime(&utc);
+  uint64_t elapsed = 0;
+  FakeCounters counters = {0};
+
+  for (uint64_t done = 0; done < ticks; ) {
+    int count = (ticks - done < SAMPLE_COUNT) ? (int)(ticks - done) : SAMPLE_COUNT;
+    for (int i = 0; i < count; i++) {
+      utc += step;
+      batch[i].utc = utc;
+      batch[i].local = *localtime(&utc);
+      batch[i].units = units_changed(&prev, &batch[i].local);
+      prev = batch[i].local;
+    }
+    fake_counters_reset();
+    uint64_t begin = now_ns();
+    for (int i = 0; i < count; i++) {
+      fake_clock_set(batch[i].utc);
+      tick_handler(&batch[i].local, batch[i].units);
+    }
+    elapsed += now_ns() - begin;
+    counters.allocations += fake_counters.allocations;
+    counters.text_updates += fake_counters.text_updates;
+    counters.dirty_marks += fake_counters.dirty_marks;
+    counters.resource_reads += fake_counters.resource_reads;
+    done += count;
+  }
+  fake_counters = counters;
+  fake_clock_set(start);
+  report(name, ticks, elapsed);
+}
+
+// Full identifier ("America/New_York") of a database row
+static void row_identifier(int row, char *buffer, size_t size) {
+  TzDbRow db_row;
+  char prefix[TZ_DB_MAX_STRING];
+  char name[TZ_DB_MAX_STRING];
+  tz_db_load_row(row, &db_row);
+  tz_db_load_string(tz_db_read_u16(TZ_DB_PREFIXES_OFFSET + db_row.prefix_index * 2), prefix);
+  tz_db_load_string(db_row.name_offset, name);
+  snprintf(buffer, size, "%s%s", prefix, name);
+}
+
+int main(int argc, char **argv) {
+  uint64_t ticks = argc > 1 ? strtoull(argv[1], NULL, 10) : 5000000;
+
+  setenv("TZ", "America/Sao_Paulo", 1);
+  tzset();
+  fake_resource_set_dir(APP_RESOURCE_DIR);
+  fake_clock_set(1741500000);  // 2025-03-09, hours before the US DST change
+
+  prv_init();
+  always_show_home = true;
+  load_timezone_config(1, "Europe/London");
+  load_timezone_config(2, "America/New_York");
+  load_timezone_config(3, "Asia/Kolkata");
+  update_active_timezone_count();
+  current_timezone_index = 2;
+  update_time_display();
+
+  char screen[256];
+  fake_window_text(fake_top_window(), screen, sizeof(screen));
+  printf("Screen: %s\n\n", screen);
+
+  static char identifiers[SHARED_TIMEZONE_COUNT][2 * TZ_DB_MAX_STRING];
+  for (int row = 0; row < SHARED_TIMEZONE_COUNT; row++) {
+    row_identifier(row, identifiers[row], sizeof(identifiers[row]));
+  }
+
+  // Random (rule, instant) pairs spread over the transition window
+  static struct {
+    uint8_t rule;
+    int16_t base;
+    time_t utc;
+  } samples[SAMPLE_COUNT];
+  uint32_t seed = 12345;
+  time_t window_start = TZ_TRANSITION_TIMES[0];
+  time_t window_end = TZ_TRANSITION_TIMES[TZ_TRANSITION_COUNT - 1];
+  for (int i = 0; i < SAMPLE_COUNT; i++) {
+    seed = seed * 1103515245u + 12345u;
+    samples[i].rule = seed % TZ_RULE_COUNT;
+    samples[i].base = -300;
+    samples[i].utc = window_start + (time_t)(seed % (uint32_t)(window_end - window_start));
+  }
+
+  printf("%-34s %10s %10s %10s %10s %10s %10s\n", "benchmark", "calls", "ns/call", "allocs", "text/call",
+         "dirty/call", "res/call");
+
+  BENCH("get_dst_adjusted_offset", 10000000, {
+    time_t from, until;
+    int s = i % SAMPLE_COUNT;
+    s_sink = get_dst_adjusted_offset(samples[s].rule, samples[s].base, samples[s].utc, &from, &until);
+  });
+
+  time_t utc = fake_clock_now();
+  BENCH("get_slot_offset (1s steps)", 10000000, {
+    s_sink = get_slot_offset(2, utc + (time_t)i);
+  });
+
+  BENCH("find_timezone_by_identifier", 1000000, {
+    s_sink = find_timezone_by_identifier(identifiers[i % SHARED_TIMEZONE_COUNT]);
+  });
+
+  BENCH("load_timezone_config", 1000000, {
+    load_timezone_config(4, identifiers[i % SHARED_TIMEZONE_COUNT]);
+  });
+
+  BENCH("update_time_display", 1000000, {
+    update_time_display();
+  });
+
+  show_seconds = true;
+  show_home_seconds = true;
+  update_time_display();
+  fake_window_text(fake_top_window(), screen, sizeof(screen));
+  printf("\nScreen with seconds: %s\n", screen);
+  bench_ticks("tick_handler (seconds)", ticks, 1);
+
+  show_seconds = false;
+  show_home_seconds = false;
+  update_time_display();
+  bench_ticks("tick_handler (minutes)", ticks / 60, 60);
+
+  return 0;
+}
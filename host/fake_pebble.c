@@ -0,0 +1,708 @@
+// Host implementations of the Pebble SDK calls the watch code uses. Layers are plain
+// structs, persist is an in-memory key table and resources are read from the app's
+// resources directory. Allocations are counted through the linker's --wrap option.
+#include "fake_pebble.h"
+
+FakeCounters fake_counters;
+
+void fake_counters_reset(void) {
+  memset(&fake_counters, 0, sizeof(fake_counters));
+}
+
+// Allocation counting (linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc)
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+  fake_counters.allocations++;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+  fake_counters.allocations++;
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+  fake_counters.allocations++;
+  return __real_realloc(ptr, size);
+}
+
+// Clock
+static time_t s_now;
+
+void fake_clock_set(time_t utc) {
+  s_now = utc;
+}
+
+time_t fake_clock_now(void) {
+  return s_now;
+}
+
+time_t fake_time(time_t *tloc) {
+  if (tloc) {
+    *tloc = s_now;
+  }
+  return s_now;
+}
+
+bool clock_is_24h_style(void) {
+  return true;
+}
+
+// Windows and layers
+struct Layer {
+  GRect frame;
+  bool hidden;
+  bool is_text_layer;
+  LayerUpdateProc update_proc;
+  Layer *first_child;
+  Layer *next_sibling;
+};
+
+struct TextLayer {
+  Layer layer;
+  const char *text;
+};
+
+struct Window {
+  Layer root;
+  WindowHandlers handlers;
+};
+
+static Window *s_top_window;
+
+GFont fonts_get_system_font(const char *font_key) {
+  return font_key;
+}
+
+Window *window_create(void) {
+  Window *window = calloc(1, sizeof(Window));
+  window->root.frame = GRect(0, 0, 144, 168);
+  return window;
+}
+
+void window_destroy(Window *window) {
+  free(window);
+}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers) {
+  window->handlers = handlers;
+}
+
+void window_set_background_color(Window *window, GColor color) {
+}
+
+Layer *window_get_root_layer(const Window *window) {
+  return (Layer *)&window->root;
+}
+
+void window_stack_push(Window *window, bool animated) {
+  s_top_window = window;
+  if (window->handlers.load) {
+    window->handlers.load(window);
+  }
+}
+
+Window *window_stack_pop(bool animated) {
+  Window *window = s_top_window;
+  if (window && window->handlers.unload) {
+    window->handlers.unload(window);
+  }
+  s_top_window = NULL;
+  return window;
+}
+
+Window *fake_top_window(void) {
+  return s_top_window;
+}
+
+bool grect_equal(const GRect *const rect_a, const GRect *const rect_b) {
+  return rect_a->origin.x == rect_b->origin.x && rect_a->origin.y == rect_b->origin.y &&
+         rect_a->size.w == rect_b->size.w && rect_a->size.h == rect_b->size.h;
+}
+
+GRect layer_get_frame(const Layer *layer) {
+  return layer->frame;
+}
+
+void layer_set_frame(Layer *layer, GRect frame) {
+  layer->frame = frame;
+}
+
+GRect layer_get_bounds(const Layer *layer) {
+  return GRect(0, 0, layer->frame.size.w, layer->frame.size.h);
+}
+
+void layer_add_child(Layer *parent, Layer *child) {
+  Layer **link = &parent->first_child;
+  while (*link) {
+    link = &(*link)->next_sibling;
+  }
+  *link = child;
+}
+
+Layer *layer_create(GRect frame) {
+  Layer *layer = calloc(1, sizeof(Layer));
+  layer->frame = frame;
+  return layer;
+}
+
+void layer_destroy(Layer *layer) {
+  free(layer);
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {
+  layer->update_proc = update_proc;
+}
+
+void layer_set_hidden(Layer *layer, bool hidden) {
+  layer->hidden = hidden;
+}
+
+void layer_mark_dirty(Layer *layer) {
+  fake_counters.dirty_marks++;
+}
+
+TextLayer *text_layer_create(GRect frame) {
+  TextLayer *text_layer = calloc(1, sizeof(TextLayer));
+  text_layer->layer.frame = frame;
+  text_layer->layer.is_text_layer = true;
+  return text_layer;
+}
+
+void text_layer_destroy(TextLayer *text_layer) {
+  free(text_layer);
+}
+
+Layer *text_layer_get_layer(TextLayer *text_layer) {
+  return &text_layer->layer;
+}
+
+void text_layer_set_text(TextLayer *text_layer, const char *text) {
+  fake_counters.text_updates++;
+  text_layer->text = text;
+}
+
+const char *text_layer_get_text(TextLayer *text_layer) {
+  return text_layer->text;
+}
+
+void text_layer_set_font(TextLayer *text_layer, GFont font) {
+}
+
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment alignment) {
+}
+
+void text_layer_set_text_color(TextLayer *text_layer, GColor color) {
+}
+
+void text_layer_set_background_color(TextLayer *text_layer, GColor color) {
+}
+
+// Graphics: drawing text appends it to the context's buffer
+struct GContext {
+  char *buffer;
+  size_t size;
+};
+
+static void append_line(char *buffer, size_t size, const char *text) {
+  size_t used = strlen(buffer);
+  snprintf(buffer + used, size - used, "%s%s", used ? " | " : "", text);
+}
+
+void graphics_context_set_text_color(GContext *ctx, GColor color) {
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont const font, const GRect box,
+                        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+                        GTextAttributes *const text_attributes) {
+  append_line(ctx->buffer, ctx->size, text);
+}
+
+// Every glyph is 8 pixels wide and text never wraps
+GSize graphics_text_layout_get_content_size(const char *text, GFont const font, const GRect box,
+                                            const GTextOverflowMode overflow_mode,
+                                            const GTextAlignment alignment) {
+  return (GSize){(int16_t)(8 * strlen(text)), 16};
+}
+
+static void layer_text(Layer *layer, GContext *ctx) {
+  for (; layer; layer = layer->next_sibling) {
+    if (layer->hidden) {
+      continue;
+    }
+    if (layer->is_text_layer) {
+      const char *text = ((TextLayer *)layer)->text;
+      append_line(ctx->buffer, ctx->size, text ? text : "");
+    } else if (layer->update_proc) {
+      layer->update_proc(layer, ctx);
+    }
+    layer_text(layer->first_child, ctx);
+  }
+}
+
+void fake_window_text(Window *window, char *buffer, size_t size) {
+  GContext ctx = {buffer, size};
+  buffer[0] = '\0';
+  layer_text(window->root.first_child, &ctx);
+}
+
+// Single-click handlers are recorded for fake_click(); the provider runs as it is set
+static ClickHandler s_click_handlers[BUTTON_ID_DOWN + 1];
+
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler) {
+  s_click_handlers[button_id] = handler;
+}
+
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms, ClickHandler down_handler,
+                                 ClickHandler up_handler) {
+}
+
+void window_set_click_config_provider(Window *window, ClickConfigProvider click_config_provider) {
+  click_config_provider(NULL);
+}
+
+void fake_click(ButtonId button) {
+  if (s_click_handlers[button]) {
+    s_click_handlers[button](NULL, NULL);
+  }
+}
+
+// The subscription is recorded; ticks arrive only through fake_tick()
+static TimeUnits s_tick_units;
+static TickHandler s_tick_handler;
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler) {
+  s_tick_units = tick_units;
+  s_tick_handler = handler;
+}
+
+void tick_timer_service_unsubscribe(void) {
+  s_tick_units = 0;
+  s_tick_handler = NULL;
+}
+
+TimeUnits fake_tick_units(void) {
+  return s_tick_units;
+}
+
+void fake_tick(TimeUnits units_changed) {
+  if (s_tick_handler) {
+    time_t now = fake_clock_now();
+    struct tm local = *localtime(&now);
+    s_tick_handler(&local, units_changed);
+  }
+}
+
+static AccelTapHandler s_tap_handler;
+
+void accel_tap_service_subscribe(AccelTapHandler handler) {
+  s_tap_handler = handler;
+}
+
+void accel_tap_service_unsubscribe(void) {
+  s_tap_handler = NULL;
+}
+
+void fake_tap(void) {
+  if (s_tap_handler) {
+    s_tap_handler(ACCEL_AXIS_Z, 1);
+  }
+}
+
+// Timers are kept in registration order and fire only through fake_timer_fire()
+struct AppTimer {
+  AppTimerCallback callback;
+  void *data;
+  uint32_t timeout_ms;
+};
+
+#define FAKE_TIMER_SLOTS 8
+
+static AppTimer *s_timers[FAKE_TIMER_SLOTS];
+static int s_timer_count;
+
+static void timer_remove(AppTimer *timer) {
+  for (int i = 0; i < s_timer_count; i++) {
+    if (s_timers[i] == timer) {
+      memmove(&s_timers[i], &s_timers[i + 1], (s_timer_count - i - 1) * sizeof(s_timers[0]));
+      s_timer_count--;
+      return;
+    }
+  }
+}
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data) {
+  if (s_timer_count == FAKE_TIMER_SLOTS) {
+    return NULL;
+  }
+  AppTimer *timer = calloc(1, sizeof(AppTimer));
+  timer->callback = callback;
+  timer->data = callback_data;
+  timer->timeout_ms = timeout_ms;
+  s_timers[s_timer_count++] = timer;
+  return timer;
+}
+
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms) {
+  timer_handle->timeout_ms = new_timeout_ms;
+  return true;
+}
+
+void app_timer_cancel(AppTimer *timer_handle) {
+  timer_remove(timer_handle);
+  free(timer_handle);
+}
+
+int fake_timer_count(void) {
+  return s_timer_count;
+}
+
+uint32_t fake_timer_fire(void) {
+  if (!s_timer_count) {
+    return 0;
+  }
+  AppTimer *timer = s_timers[0];
+  timer_remove(timer);
+  uint32_t timeout_ms = timer->timeout_ms;
+  timer->callback(timer->data);
+  free(timer);
+  return timeout_ms;
+}
+
+// Battery, health and Quiet Time state is set by the harness; setters notify subscribers
+static BatteryChargeState s_battery = { .charge_percent = 100 };
+static BatteryStateHandler s_battery_handler;
+static HealthActivityMask s_activities;
+static HealthEventHandler s_health_handler;
+static void *s_health_context;
+static bool s_quiet_time;
+
+void battery_state_service_subscribe(BatteryStateHandler handler) {
+  s_battery_handler = handler;
+}
+
+void battery_state_service_unsubscribe(void) {
+  s_battery_handler = NULL;
+}
+
+BatteryChargeState battery_state_service_peek(void) {
+  return s_battery;
+}
+
+void fake_battery_set(BatteryChargeState charge) {
+  s_battery = charge;
+  if (s_battery_handler) {
+    s_battery_handler(charge);
+  }
+}
+
+bool health_service_events_subscribe(HealthEventHandler handler, void *context) {
+  s_health_handler = handler;
+  s_health_context = context;
+  return true;
+}
+
+bool health_service_events_unsubscribe(void) {
+  s_health_handler = NULL;
+  return true;
+}
+
+HealthActivityMask health_service_peek_current_activities(void) {
+  return s_activities;
+}
+
+void fake_health_set_activities(HealthActivityMask activities) {
+  s_activities = activities;
+  if (s_health_handler) {
+    s_health_handler(HealthEventSleepUpdate, s_health_context);
+  }
+}
+
+bool quiet_time_is_active(void) {
+  return s_quiet_time;
+}
+
+void fake_quiet_time_set(bool active) {
+  s_quiet_time = active;
+}
+
+void light_enable_interaction(void) {
+}
+
+void vibes_short_pulse(void) {
+}
+
+void app_event_loop(void) {
+}
+
+// AppMessage
+const uint32_t MESSAGE_KEY_HOME = 10000;
+const uint32_t MESSAGE_KEY_TIMEZONE_1 = 10001;
+const uint32_t MESSAGE_KEY_TIMEZONE_2 = 10002;
+const uint32_t MESSAGE_KEY_TIMEZONE_3 = 10003;
+const uint32_t MESSAGE_KEY_TIMEZONE_4 = 10004;
+const uint32_t MESSAGE_KEY_ALWAYS_SHOW_HOME = 10005;
+const uint32_t MESSAGE_KEY_BACKGROUND_COLOR = 10006;
+const uint32_t MESSAGE_KEY_TIME_COLOR = 10007;
+const uint32_t MESSAGE_KEY_TIMEZONE_LABEL_COLOR = 10008;
+const uint32_t MESSAGE_KEY_HOME_TIME_COLOR = 10009;
+const uint32_t MESSAGE_KEY_SHOW_SECONDS = 10010;
+const uint32_t MESSAGE_KEY_SHOW_HOME_SECONDS = 10011;
+const uint32_t MESSAGE_KEY_SECONDS_WINDOW = 10012;
+const uint32_t MESSAGE_KEY_POWER_NO_SECONDS_BELOW = 10013;
+const uint32_t MESSAGE_KEY_POWER_FREEZE_HOME_BELOW = 10014;
+const uint32_t MESSAGE_KEY_POWER_HOURLY_BELOW = 10015;
+const uint32_t MESSAGE_KEY_POWER_SAVE_ASLEEP = 10016;
+const uint32_t MESSAGE_KEY_CONFIG = 10017;
+const uint32_t MESSAGE_KEY_CONFIG_REVISION = 10018;
+const uint32_t MESSAGE_KEY_SCHEDULE = 10019;
+const uint32_t MESSAGE_KEY_OVERLAY = 10020;
+
+// Messages are a flat run of packed tuples, as on the watch
+struct DictionaryIterator {
+  uint8_t buffer[1024];
+  size_t length;
+};
+
+static DictionaryIterator s_message;
+static AppMessageInboxReceived s_inbox_received;
+
+DictionaryIterator *fake_message_begin(void) {
+  s_message.length = 0;
+  return &s_message;
+}
+
+
+static void message_append(DictionaryIterator *message, uint32_t key, TupleType type,
+                           const void *data, uint16_t length) {
+  Tuple tuple = { .key = key, .type = type, .length = length };
+  memcpy(message->buffer + message->length, &tuple, sizeof(tuple));
+  memcpy(message->buffer + message->length + sizeof(tuple), data, length);
+  message->length += sizeof(tuple) + length;
+}
+
+void fake_message_deliver(void) {
+  if (s_inbox_received) {
+    s_inbox_received(&s_message, NULL);
+  }
+}
+
+void fake_message_add_bytes(uint32_t key, const uint8_t *data, uint16_t length) {
+  message_append(&s_message, key, TUPLE_BYTE_ARRAY, data, length);
+}
+
+// The outbox holds one message; sending only counts it
+static DictionaryIterator s_outbox;
+static int s_outbox_sends;
+
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator) {
+  s_outbox.length = 0;
+  *iterator = &s_outbox;
+  return APP_MSG_OK;
+}
+
+AppMessageResult app_message_outbox_send(void) {
+  s_outbox_sends++;
+  return APP_MSG_OK;
+}
+
+DictionaryResult dict_write_uint16(DictionaryIterator *iter, const uint32_t key, const uint16_t value) {
+  message_append(iter, key, TUPLE_UINT, &value, sizeof(value));
+  return DICT_OK;
+}
+
+const DictionaryIterator *fake_outbox_last(int *sends) {
+  *sends = s_outbox_sends;
+  return &s_outbox;
+}
+
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key) {
+  size_t offset = 0;
+  while (offset < iter->length) {
+    Tuple *tuple = (Tuple *)(iter->buffer + offset);
+    if (tuple->key == key) {
+      return tuple;
+    }
+    offset += sizeof(Tuple) + tuple->length;
+  }
+  return NULL;
+}
+
+void app_message_register_inbox_received(AppMessageInboxReceived received_callback) {
+  s_inbox_received = received_callback;
+}
+
+void app_message_register_inbox_dropped(AppMessageInboxDropped dropped_callback) {
+}
+
+void app_message_register_outbox_sent(AppMessageOutboxSent sent_callback) {
+}
+
+void app_message_register_outbox_failed(AppMessageOutboxFailed failed_callback) {
+}
+
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound) {
+  return APP_MSG_OK;
+}
+
+// Persistent storage: a small fixed table, like the watch's 4KB per-app store
+#define FAKE_PERSIST_SLOTS 64
+
+typedef struct {
+  bool used;
+  uint32_t key;
+  int size;
+  uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} FakePersistEntry;
+
+static FakePersistEntry s_persist[FAKE_PERSIST_SLOTS];
+
+void fake_persist_reset(void) {
+  memset(s_persist, 0, sizeof(s_persist));
+}
+
+static FakePersistEntry *persist_find(uint32_t key) {
+  for (int i = 0; i < FAKE_PERSIST_SLOTS; i++) {
+    if (s_persist[i].used && s_persist[i].key == key) {
+      return &s_persist[i];
+    }
+  }
+  return NULL;
+}
+
+bool persist_exists(const uint32_t key) {
+  fake_counters.persist_reads++;
+  return persist_find(key) != NULL;
+}
+
+int persist_get_size(const uint32_t key) {
+  fake_counters.persist_reads++;
+  FakePersistEntry *entry = persist_find(key);
+  return entry ? entry->size : -1;
+}
+
+int persist_delete(const uint32_t key) {
+  FakePersistEntry *entry = persist_find(key);
+  if (!entry) {
+    return -1;
+  }
+  entry->used = false;
+  return 0;
+}
+
+int persist_write_data(const uint32_t key, const void *data, const size_t size) {
+  fake_counters.persist_writes++;
+  FakePersistEntry *entry = persist_find(key);
+  for (int i = 0; !entry && i < FAKE_PERSIST_SLOTS; i++) {
+    if (!s_persist[i].used) {
+      entry = &s_persist[i];
+    }
+  }
+  if (!entry) {
+    return -1;
+  }
+  size_t length = size < PERSIST_DATA_MAX_LENGTH ? size : PERSIST_DATA_MAX_LENGTH;
+  entry->used = true;
+  entry->key = key;
+  entry->size = (int)length;
+  memcpy(entry->data, data, length);
+  return (int)length;
+}
+
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size) {
+  fake_counters.persist_reads++;
+  FakePersistEntry *entry = persist_find(key);
+  if (!entry) {
+    return -1;
+  }
+  size_t length = (size_t)entry->size < buffer_size ? (size_t)entry->size : buffer_size;
+  memcpy(buffer, entry->data, length);
+  return (int)length;
+}
+
+int persist_write_bool(const uint32_t key, const bool value) {
+  return persist_write_data(key, &value, sizeof(value));
+}
+
+bool persist_read_bool(const uint32_t key) {
+  bool value = false;
+  persist_read_data(key, &value, sizeof(value));
+  return value;
+}
+
+int persist_write_int(const uint32_t key, const int32_t value) {
+  return persist_write_data(key, &value, sizeof(value));
+}
+
+int32_t persist_read_int(const uint32_t key) {
+  int32_t value = 0;
+  persist_read_data(key, &value, sizeof(value));
+  return value;
+}
+
+int persist_write_string(const uint32_t key, const char *cstring) {
+  return persist_write_data(key, cstring, strlen(cstring) + 1);
+}
+
+int persist_read_string(const uint32_t key, char *buffer, const size_t buffer_size) {
+  int length = persist_read_data(key, buffer, buffer_size);
+  if (length > 0) {
+    buffer[length - 1] = '\0';
+  }
+  return length;
+}
+
+// Resources
+static const char *s_resource_dir = ".";
+static uint8_t *s_timezone_db;
+static size_t s_timezone_db_size;
+
+void fake_resource_set_dir(const char *dir) {
+  s_resource_dir = dir;
+  free(s_timezone_db);
+  s_timezone_db = NULL;
+}
+
+ResHandle resource_get_handle(uint32_t resource_id) {
+  if (resource_id != RESOURCE_ID_TIMEZONE_DB) {
+    return NULL;
+  }
+  if (!s_timezone_db) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/data/timezones.bin", s_resource_dir);
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+      fprintf(stderr, "Cannot open resource %s\n", path);
+      exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    s_timezone_db_size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    s_timezone_db = malloc(s_timezone_db_size);
+    if (fread(s_timezone_db, 1, s_timezone_db_size, f) != s_timezone_db_size) {
+      fprintf(stderr, "Short read of %s\n", path);
+      exit(1);
+    }
+    fclose(f);
+  }
+  return s_timezone_db;
+}
+
+size_t resource_size(ResHandle h) {
+  return s_timezone_db_size;
+}
+
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer, size_t num_bytes) {
+  fake_counters.resource_reads++;
+  if (start_offset >= s_timezone_db_size) {
+    return 0;
+  }
+  if (num_bytes > s_timezone_db_size - start_offset) {
+    num_bytes = s_timezone_db_size - start_offset;
+  }
+  memcpy(buffer, (const uint8_t *)h + start_offset, num_bytes);
+  return num_bytes;
+}
@@ -0,0 +1,65 @@
+// Controls for the fake Pebble runtime in fake_pebble.c
+#pragma once
+
+#include <pebble.h>
+
+// Fake clock read by time(); the watch code sees whatever is set here
+void fake_clock_set(time_t utc);
+time_t fake_clock_now(void);
+
+// Directory holding the app's resources (the one containing data/timezones.bin)
+void fake_resource_set_dir(const char *dir);
+
+// Wipes every persisted key, as if the app were freshly installed
+void fake_persist_reset(void);
+
+// Battery, health activity and Quiet Time as the watch code sees them. The battery and
+// health setters call the subscribed handler; Quiet Time has no event, as on the watch.
+void fake_battery_set(BatteryChargeState charge);
+void fake_health_set_activities(HealthActivityMask activities);
+void fake_quiet_time_set(bool active);
+
+// Units of the current tick_timer_service subscription, 0 if none, and a tick with the
+// given units changed delivered to its handler at the fake clock's time
+TimeUnits fake_tick_units(void);
+void fake_tick(TimeUnits units_changed);
+
+// An accelerometer tap or a button's single click, delivered to the subscribed handler
+void fake_tap(void);
+void fake_click(ButtonId button);
+
+// App timers still pending, and the oldest one fired, as if its timeout had run out;
+// returns that timeout in ms, 0 if no timer was pending
+int fake_timer_count(void);
+uint32_t fake_timer_fire(void);
+
+// Builds an incoming AppMessage and hands it to the registered inbox handler:
+// fake_message_begin() starts an empty message, fake_message_add_bytes() appends a
+// byte-array tuple, fake_message_deliver() calls the handler
+DictionaryIterator *fake_message_begin(void);
+void fake_message_add_bytes(uint32_t key, const uint8_t *data, uint16_t length);
+void fake_message_deliver(void);
+
+// Last message the watch code sent, readable with dict_find(); *sends counts every send
+const DictionaryIterator *fake_outbox_last(int *sends);
+
+// Counters for work the watch code asks of the SDK
+typedef struct {
+  uint64_t allocations;       // malloc/calloc/realloc calls from the watch code and fakes
+  uint64_t text_updates;      // text_layer_set_text calls
+  uint64_t dirty_marks;       // layer_mark_dirty calls
+  uint64_t resource_reads;    // resource_load_byte_range calls
+  uint64_t persist_writes;    // persist_write_* calls
+  uint64_t persist_reads;     // persist_exists, persist_get_size and persist_read_* calls
+} FakeCounters;
+
+extern FakeCounters fake_counters;
+void fake_counters_reset(void);
+
+// Window most recently pushed with window_stack_push (which also runs its load handler)
+Window *fake_top_window(void);
+
+// Text a window currently shows, one visible line after another separated by " | ":
+// text layers contribute their text, custom layers whatever their update_proc draws.
+// Lets the TextLayer and single-Layer renderers be compared.
+void fake_window_text(Window *window, char *buffer, size_t size);
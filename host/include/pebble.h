@@ -0,0 +1,281 @@
+// Minimal stand-in for the Pebble SDK header, enough to compile the watch-face and
+// watch-app sources on a Linux host. Declarations follow the SDK 3 signatures; the
+// implementations live in fake_pebble.c.
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Graphics types
+typedef struct Window Window;
+typedef struct Layer Layer;
+typedef struct TextLayer TextLayer;
+typedef struct GContext GContext;
+typedef struct GTextAttributes GTextAttributes;
+
+typedef struct {
+  int16_t x;
+  int16_t y;
+} GPoint;
+
+typedef struct {
+  int16_t w;
+  int16_t h;
+} GSize;
+
+typedef struct {
+  GPoint origin;
+  GSize size;
+} GRect;
+
+#define GRect(x, y, w, h) ((GRect){{(x), (y)}, {(w), (h)}})
+bool grect_equal(const GRect *const rect_a, const GRect *const rect_b);
+
+#define ARRAY_LENGTH(array) (sizeof(array) / sizeof((array)[0]))
+
+typedef union {
+  uint8_t argb;
+} GColor;
+
+#define PBL_COLOR 1
+#define GColorFromHEX(hex) ((GColor){(uint8_t)(0xC0 | (((hex) >> 18) & 0x30) | (((hex) >> 12) & 0x0C) | (((hex) >> 6) & 0x03))})
+#define GColorBlack ((GColor){0xC0})
+#define GColorWhite ((GColor){0xFF})
+#define GColorLightGray ((GColor){0xEA})
+#define GColorClear ((GColor){0x00})
+
+typedef enum { GTextAlignmentLeft, GTextAlignmentCenter, GTextAlignmentRight } GTextAlignment;
+typedef enum { GTextOverflowModeWordWrap, GTextOverflowModeTrailingEllipsis, GTextOverflowModeFill } GTextOverflowMode;
+
+typedef const char *GFont;
+#define FONT_KEY_GOTHIC_14 "GOTHIC_14"
+#define FONT_KEY_GOTHIC_18 "GOTHIC_18"
+#define FONT_KEY_GOTHIC_18_BOLD "GOTHIC_18_BOLD"
+#define FONT_KEY_GOTHIC_24_BOLD "GOTHIC_24_BOLD"
+#define FONT_KEY_LECO_26_BOLD_NUMBERS_AM_PM "LECO_26_BOLD_NUMBERS_AM_PM"
+GFont fonts_get_system_font(const char *font_key);
+
+// Windows and layers
+typedef void (*WindowHandler)(Window *window);
+typedef struct {
+  WindowHandler load;
+  WindowHandler appear;
+  WindowHandler disappear;
+  WindowHandler unload;
+} WindowHandlers;
+
+Window *window_create(void);
+void window_destroy(Window *window);
+void window_set_window_handlers(Window *window, WindowHandlers handlers);
+void window_set_background_color(Window *window, GColor color);
+Layer *window_get_root_layer(const Window *window);
+void window_stack_push(Window *window, bool animated);
+Window *window_stack_pop(bool animated);
+
+GRect layer_get_bounds(const Layer *layer);
+GRect layer_get_frame(const Layer *layer);
+void layer_set_frame(Layer *layer, GRect frame);
+void layer_add_child(Layer *parent, Layer *child);
+void layer_set_hidden(Layer *layer, bool hidden);
+void layer_mark_dirty(Layer *layer);
+
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+Layer *layer_create(GRect frame);
+void layer_destroy(Layer *layer);
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+
+void graphics_context_set_text_color(GContext *ctx, GColor color);
+void graphics_draw_text(GContext *ctx, const char *text, GFont const font, const GRect box,
+                        const GTextOverflowMode overflow_mode, const GTextAlignment alignment,
+                        GTextAttributes *const text_attributes);
+GSize graphics_text_layout_get_content_size(const char *text, GFont const font, const GRect box,
+                                            const GTextOverflowMode overflow_mode,
+                                            const GTextAlignment alignment);
+
+TextLayer *text_layer_create(GRect frame);
+void text_layer_destroy(TextLayer *text_layer);
+Layer *text_layer_get_layer(TextLayer *text_layer);
+void text_layer_set_text(TextLayer *text_layer, const char *text);
+const char *text_layer_get_text(TextLayer *text_layer);
+void text_layer_set_font(TextLayer *text_layer, GFont font);
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment alignment);
+void text_layer_set_text_color(TextLayer *text_layer, GColor color);
+void text_layer_set_background_color(TextLayer *text_layer, GColor color);
+
+// Buttons
+typedef enum { BUTTON_ID_BACK, BUTTON_ID_UP, BUTTON_ID_SELECT, BUTTON_ID_DOWN } ButtonId;
+typedef void *ClickRecognizerRef;
+typedef void (*ClickHandler)(ClickRecognizerRef recognizer, void *context);
+typedef void (*ClickConfigProvider)(void *context);
+void window_single_click_subscribe(ButtonId button_id, ClickHandler handler);
+void window_long_click_subscribe(ButtonId button_id, uint16_t delay_ms, ClickHandler down_handler,
+                                 ClickHandler up_handler);
+void window_set_click_config_provider(Window *window, ClickConfigProvider click_config_provider);
+
+// Event services
+typedef enum {
+  SECOND_UNIT = 1 << 0,
+  MINUTE_UNIT = 1 << 1,
+  HOUR_UNIT = 1 << 2,
+  DAY_UNIT = 1 << 3,
+  MONTH_UNIT = 1 << 4,
+  YEAR_UNIT = 1 << 5
+} TimeUnits;
+typedef void (*TickHandler)(struct tm *tick_time, TimeUnits units_changed);
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler);
+void tick_timer_service_unsubscribe(void);
+
+typedef enum { ACCEL_AXIS_X, ACCEL_AXIS_Y, ACCEL_AXIS_Z } AccelAxisType;
+typedef void (*AccelTapHandler)(AccelAxisType axis, int32_t direction);
+void accel_tap_service_subscribe(AccelTapHandler handler);
+void accel_tap_service_unsubscribe(void);
+
+typedef struct AppTimer AppTimer;
+typedef void (*AppTimerCallback)(void *data);
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data);
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms);
+void app_timer_cancel(AppTimer *timer_handle);
+
+typedef struct {
+  uint8_t charge_percent;
+  bool is_charging;
+  bool is_plugged;
+} BatteryChargeState;
+typedef void (*BatteryStateHandler)(BatteryChargeState charge);
+void battery_state_service_subscribe(BatteryStateHandler handler);
+void battery_state_service_unsubscribe(void);
+BatteryChargeState battery_state_service_peek(void);
+
+// Health: the fakes behave like a platform with health support
+#define PBL_HEALTH 1
+typedef enum {
+  HealthActivityNone = 0,
+  HealthActivitySleep = 1 << 0,
+  HealthActivityRestfulSleep = 1 << 1,
+  HealthActivityWalk = 1 << 2,
+  HealthActivityRun = 1 << 3,
+  HealthActivityOpenWorkout = 1 << 4
+} HealthActivity;
+typedef uint32_t HealthActivityMask;
+typedef enum {
+  HealthEventSignificantUpdate = 0,
+  HealthEventMovementUpdate,
+  HealthEventSleepUpdate,
+  HealthEventMetricAlert,
+  HealthEventHeartRateUpdate
+} HealthEventType;
+typedef void (*HealthEventHandler)(HealthEventType event, void *context);
+bool health_service_events_subscribe(HealthEventHandler handler, void *context);
+bool health_service_events_unsubscribe(void);
+HealthActivityMask health_service_peek_current_activities(void);
+
+// Every API the fakes declare exists
+#define PBL_API_EXISTS(api) true
+bool quiet_time_is_active(void);
+
+bool clock_is_24h_style(void);
+void light_enable_interaction(void);
+void vibes_short_pulse(void);
+
+// Clock: time() reads the fake clock so benchmarks can simulate ticks
+time_t fake_time(time_t *tloc);
+#define time(tloc) fake_time(tloc)
+
+// AppMessage
+typedef enum { APP_MSG_OK = 0, APP_MSG_SEND_TIMEOUT = 2, APP_MSG_BUSY = 64 } AppMessageResult;
+typedef enum { TUPLE_BYTE_ARRAY = 0, TUPLE_CSTRING = 1, TUPLE_UINT = 2, TUPLE_INT = 3 } TupleType;
+
+typedef struct __attribute__((__packed__)) {
+  uint32_t key;
+  TupleType type : 8;
+  uint16_t length;
+  union {
+    uint8_t data[0];
+    char cstring[0];
+    uint8_t uint8;
+    uint16_t uint16;
+    uint32_t uint32;
+    int8_t int8;
+    int16_t int16;
+    int32_t int32;
+  } value[];
+} Tuple;
+
+typedef struct DictionaryIterator DictionaryIterator;
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key);
+
+typedef void (*AppMessageInboxReceived)(DictionaryIterator *iterator, void *context);
+typedef void (*AppMessageInboxDropped)(AppMessageResult reason, void *context);
+typedef void (*AppMessageOutboxSent)(DictionaryIterator *iterator, void *context);
+typedef void (*AppMessageOutboxFailed)(DictionaryIterator *iterator, AppMessageResult reason, void *context);
+void app_message_register_inbox_received(AppMessageInboxReceived received_callback);
+void app_message_register_inbox_dropped(AppMessageInboxDropped dropped_callback);
+void app_message_register_outbox_sent(AppMessageOutboxSent sent_callback);
+void app_message_register_outbox_failed(AppMessageOutboxFailed failed_callback);
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound);
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator);
+AppMessageResult app_message_outbox_send(void);
+
+typedef enum { DICT_OK = 0, DICT_NOT_ENOUGH_STORAGE = 1 << 1 } DictionaryResult;
+DictionaryResult dict_write_uint16(DictionaryIterator *iter, const uint32_t key, const uint16_t value);
+
+// Message keys are link-time constants on the watch, not compile-time ones
+extern const uint32_t MESSAGE_KEY_HOME;
+extern const uint32_t MESSAGE_KEY_TIMEZONE_1;
+extern const uint32_t MESSAGE_KEY_TIMEZONE_2;
+extern const uint32_t MESSAGE_KEY_TIMEZONE_3;
+extern const uint32_t MESSAGE_KEY_TIMEZONE_4;
+extern const uint32_t MESSAGE_KEY_ALWAYS_SHOW_HOME;
+extern const uint32_t MESSAGE_KEY_BACKGROUND_COLOR;
+extern const uint32_t MESSAGE_KEY_TIME_COLOR;
+extern const uint32_t MESSAGE_KEY_TIMEZONE_LABEL_COLOR;
+extern const uint32_t MESSAGE_KEY_HOME_TIME_COLOR;
+extern const uint32_t MESSAGE_KEY_SHOW_SECONDS;
+extern const uint32_t MESSAGE_KEY_SHOW_HOME_SECONDS;
+extern const uint32_t MESSAGE_KEY_SECONDS_WINDOW;
+extern const uint32_t MESSAGE_KEY_POWER_NO_SECONDS_BELOW;
+extern const uint32_t MESSAGE_KEY_POWER_FREEZE_HOME_BELOW;
+extern const uint32_t MESSAGE_KEY_POWER_HOURLY_BELOW;
+extern const uint32_t MESSAGE_KEY_POWER_SAVE_ASLEEP;
+extern const uint32_t MESSAGE_KEY_CONFIG;
+extern const uint32_t MESSAGE_KEY_CONFIG_REVISION;
+extern const uint32_t MESSAGE_KEY_SCHEDULE;
+extern const uint32_t MESSAGE_KEY_OVERLAY;
+
+// Persistent storage
+#define PERSIST_DATA_MAX_LENGTH 256
+#define PERSIST_STRING_MAX_LENGTH PERSIST_DATA_MAX_LENGTH
+bool persist_exists(const uint32_t key);
+int persist_get_size(const uint32_t key);
+int persist_delete(const uint32_t key);
+bool persist_read_bool(const uint32_t key);
+int32_t persist_read_int(const uint32_t key);
+int persist_read_data(const uint32_t key, void *buffer, const size_t buffer_size);
+int persist_read_string(const uint32_t key, char *buffer, const size_t buffer_size);
+int persist_write_bool(const uint32_t key, const bool value);
+int persist_write_int(const uint32_t key, const int32_t value);
+int persist_write_data(const uint32_t key, const void *data, const size_t size);
+int persist_write_string(const uint32_t key, const char *cstring);
+
+// Resources
+typedef const void *ResHandle;
+#define RESOURCE_ID_TIMEZONE_DB 1
+ResHandle resource_get_handle(uint32_t resource_id);
+size_t resource_size(ResHandle h);
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer, size_t num_bytes);
+
+// Logging
+typedef enum {
+  APP_LOG_LEVEL_ERROR = 1,
+  APP_LOG_LEVEL_WARNING = 50,
+  APP_LOG_LEVEL_INFO = 100,
+  APP_LOG_LEVEL_DEBUG = 200
+} AppLogLevel;
+#define APP_LOG(level, fmt, ...) ((void)0)
+
+void app_event_loop(void);
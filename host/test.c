@@ -0,0 +1,758 @@
+// Behaviour tests for the watch code, built on the host against the stub SDK like the
+// benchmarks. Messages go in through the fake inbox and replies come out of the fake
+// outbox, so each test drives the app the way the phone and the firmware would.
+//
+// Every test runs in a forked child: it starts from the app's initial state and an
+// empty persist store, as after a fresh install, and a crash fails only that test.
+//
+// Usage: test [name]   (runs every test, or those whose name contains name)
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "fake_pebble.h"
+
+#define main app_main
+#include APP_MAIN
+#undef main
+
+#define TEST_EPOCH 1752000000  // 2025-07-08 18:40:00 UTC; the host runs in UTC
+
+static int s_failures;
+
+#define CHECK(condition)                                                                 \
+  do {                                                                                   \
+    if (!(condition)) {                                                                  \
+      fprintf(stderr, "  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);    \
+      s_failures++;                                                                      \
+    }                                                                                    \
+  } while (0)
+
+// Checks the text the window shows, one visible line after another separated by " | "
+#define CHECK_SCREEN(expected)                                                           \
+  do {                                                                                   \
+    char screen_[256];                                                                   \
+    fake_window_text(fake_top_window(), screen_, sizeof(screen_));                       \
+    if (strcmp(screen_, (expected)) != 0) {                                              \
+      fprintf(stderr, "  %s:%d: screen is \"%s\", expected \"%s\"\n", __FILE__, __LINE__, \
+              screen_, (expected));                                                      \
+      s_failures++;                                                                      \
+    }                                                                                    \
+  } while (0)
+
+// Numeric id of a zone, as index.js sends it
+static uint16_t zone_id(const char *identifier) {
+  int row = find_timezone_by_identifier(identifier);
+  if (row < 0) {
+    fprintf(stderr, "  unknown zone %s\n", identifier);
+    exit(1);
+  }
+  return tz_db_read_u16(TZ_DB_ROWS_OFFSET + row * TZ_DB_ROW_SIZE);
+}
+
+// Hands one byte-array tuple to the app's inbox handler
+static void deliver(uint32_t key, const uint8_t *data, uint16_t length) {
+  fake_message_begin();
+  fake_message_add_bytes(key, data, length);
+  fake_message_deliver();
+}
+
+// Everything a CONFIG blob can carry, in the units index.js sends
+typedef struct {
+  const char *zones[MAX_TIMEZONES - 1];  // Home, Timezones 1-4; NULL = none
+  uint8_t display_flags;                 // CONFIG_FLAG_*
+  uint8_t seconds_window;
+  uint32_t colors[4];                    // 0xRRGGBB
+  uint8_t thresholds[3];
+  uint8_t power_flags;
+} TestConfig;
+
+static const TestConfig s_config = {
+  .zones = {"Europe/London", "Asia/Tokyo"},
+  .display_flags = CONFIG_FLAG_ALWAYS_SHOW_HOME,
+  .colors = {0x000055, 0xFFFFFF, 0xAAAAAA, 0x55AAFF},
+  .thresholds = {30, 20, 10},
+  .power_flags = CONFIG_FLAG_SAVE_ASLEEP,
+};
+
+// Encodes the given sections of config as encodeSections() and sendConfig() do;
+// returns the blob's length
+static uint16_t config_blob(uint8_t *out, uint8_t sections, uint16_t base, uint16_t revision,
+                            const TestConfig *config) {
+  uint8_t *end = out;
+  *end++ = CONFIG_BLOB_VERSION;
+  *end++ = sections;
+  *end++ = base & 0xFF;
+  *end++ = base >> 8;
+  *end++ = revision & 0xFF;
+  *end++ = revision >> 8;
+  if (sections & CONFIG_SECTION_ZONES) {
+    for (int i = 0; i < MAX_TIMEZONES - 1; i++) {
+      uint16_t id = config->zones[i] ? zone_id(config->zones[i]) : 0;
+      *end++ = id & 0xFF;
+      *end++ = id >> 8;
+    }
+  }
+  if (sections & CONFIG_SECTION_DISPLAY) {
+    *end++ = config->display_flags;
+    *end++ = config->seconds_window;
+  }
+  if (sections & CONFIG_SECTION_COLORS) {
+    for (int i = 0; i < 4; i++) {
+      *end++ = config->colors[i] >> 16;
+      *end++ = (config->colors[i] >> 8) & 0xFF;
+      *end++ = config->colors[i] & 0xFF;
+    }
+  }
+  if (sections & CONFIG_SECTION_POWER) {
+    memcpy(end, config->thresholds, 3);
+    end += 3;
+    *end++ = config->power_flags;
+  }
+  return (uint16_t)(end - out);
+}
+
+static void send_config(uint8_t sections, uint16_t base, uint16_t revision, const TestConfig *config) {
+  uint8_t blob[64];
+  deliver(MESSAGE_KEY_CONFIG, blob, config_blob(blob, sections, base, revision, config));
+}
+
+// A full blob configures every section, is persisted and needs no reply
+static void test_config_full_blob(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 7, &s_config);
+
+  CHECK(get_slot_zone_id(1) == zone_id("Europe/London"));
+  CHECK(get_slot_zone_id(2) == zone_id("Asia/Tokyo"));
+  for (int slot = 3; slot < MAX_TIMEZONES; slot++) {
+    CHECK(get_slot_zone_id(slot) == 0);
+  }
+  CHECK(active_timezone_count == 3);
+  CHECK(always_show_home && !show_seconds && !show_home_seconds);
+  CHECK(s_settings.colors[3] == 0x55AAFF);
+  CHECK(power_thresholds[2] == 10 && power_save_asleep);
+  CHECK(s_config_revision == 7);
+  CHECK(persist_get_size(PERSIST_KEY_SETTINGS) == (int)sizeof(Settings));
+  int sends;
+  fake_outbox_last(&sends);
+  CHECK(sends == 0);
+  CHECK_SCREEN("local (GMT +00:00) | 18:40 | Home: 19:40");
+
+  current_timezone_index = 2;
+  update_time_display();
+  CHECK_SCREEN("Tokyo (GMT +09:00) | 03:40 | Home: 19:40");
+}
+
+// A blob whose length does not match its section mask changes nothing
+static void test_config_bad_length(void) {
+  prv_init();
+  Timezone slots[MAX_TIMEZONES];
+  memcpy(slots, timezones, sizeof(slots));
+  uint8_t blob[64];
+  uint16_t length = config_blob(blob, CONFIG_SECTIONS_ALL, 0, 7, &s_config);
+  fake_counters_reset();
+  deliver(MESSAGE_KEY_CONFIG, blob, length - 1);
+
+  CHECK(s_config_revision == 0);
+  CHECK(memcmp(slots, timezones, sizeof(slots)) == 0);
+  CHECK(fake_counters.persist_writes == 0);
+  int sends;
+  fake_outbox_last(&sends);
+  CHECK(sends == 1);
+}
+
+// A delta on the applied revision changes only its own sections
+static void test_config_delta(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 7, &s_config);
+  TestConfig changed = s_config;
+  changed.zones[1] = "America/New_York";
+  changed.display_flags = CONFIG_FLAG_SHOW_SECONDS;
+  changed.seconds_window = 30;
+  changed.colors[3] = 0xFF0000;
+  send_config(CONFIG_SECTION_DISPLAY, 7, 8, &changed);
+
+  CHECK(get_slot_zone_id(2) == zone_id("Asia/Tokyo"));
+  CHECK(!always_show_home && show_seconds && seconds_window == 30);
+  CHECK(s_settings.colors[3] == 0x55AAFF);
+  CHECK(s_config_revision == 8);
+  Settings saved;
+  CHECK(persist_read_data(PERSIST_KEY_SETTINGS, &saved, sizeof(saved)) == (int)sizeof(saved));
+  CHECK(saved.config_revision == 8 && (saved.flags & CONFIG_FLAG_SHOW_SECONDS));
+  int sends;
+  fake_outbox_last(&sends);
+  CHECK(sends == 0);
+}
+
+// A delta on another revision, or a partial blob without a base, is refused and
+// answered with the revision the watch holds so the phone can resend in full
+static void test_config_wrong_base(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 7, &s_config);
+  TestConfig changed = s_config;
+  changed.zones[1] = "America/New_York";
+  fake_counters_reset();
+
+  send_config(CONFIG_SECTION_ZONES, 6, 8, &changed);
+  CHECK(get_slot_zone_id(2) == zone_id("Asia/Tokyo"));
+  CHECK(s_config_revision == 7);
+  CHECK(fake_counters.persist_writes == 0);
+  int sends;
+  const DictionaryIterator *reply = fake_outbox_last(&sends);
+  CHECK(sends == 1);
+  Tuple *revision = dict_find(reply, MESSAGE_KEY_CONFIG_REVISION);
+  CHECK(revision && revision->value->uint16 == 7);
+
+  send_config(CONFIG_SECTION_ZONES, 0, 8, &changed);
+  CHECK(get_slot_zone_id(2) == zone_id("Asia/Tokyo"));
+  fake_outbox_last(&sends);
+  CHECK(sends == 2);
+
+  // The phone's resync is a full blob, which applies whatever the watch holds
+  send_config(CONFIG_SECTIONS_ALL, 0, 8, &changed);
+  CHECK(get_slot_zone_id(2) == zone_id("America/New_York"));
+  CHECK(s_config_revision == 8);
+}
+
+// A header with no sections, as the phone sends for an unchanged save, changes nothing
+// on a watch that holds its base and is answered with the revision on one that does not
+static void test_config_revision_check(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 7, &s_config);
+  fake_counters_reset();
+
+  send_config(0, 7, 7, &s_config);
+  CHECK(s_config_revision == 7);
+  CHECK(fake_counters.persist_writes == 0);
+  int sends;
+  fake_outbox_last(&sends);
+  CHECK(sends == 0);
+
+  // A reset watch holds no revision
+  s_config_revision = 0;
+  send_config(0, 7, 7, &s_config);
+  const DictionaryIterator *reply = fake_outbox_last(&sends);
+  CHECK(sends == 1);
+  Tuple *revision = dict_find(reply, MESSAGE_KEY_CONFIG_REVISION);
+  CHECK(revision && revision->value->uint16 == 0);
+  CHECK(fake_counters.persist_writes == 0);
+}
+
+// A Settings record as save_settings() writes it
+static Settings settings_record(uint16_t revision, const TestConfig *config) {
+  Settings settings = {
+    .version = SETTINGS_VERSION,
+    .flags = SETTINGS_FLAG_SHOW_SECONDS,
+    .seconds_window = 20,
+    .config_revision = revision,
+  };
+  memcpy(settings.power_thresholds, config->thresholds, 3);
+  for (int i = 0; i < MAX_TIMEZONES - 1; i++) {
+    settings.zone_ids[i] = config->zones[i] ? zone_id(config->zones[i]) : 0;
+  }
+  memcpy(settings.colors, config->colors, sizeof(settings.colors));
+  settings.crc = crc32((const uint8_t *)&settings, sizeof(settings) - sizeof(settings.crc));
+  return settings;
+}
+
+// A valid record restores the configuration at startup without writing anything
+static void test_settings_record_loads(void) {
+  Settings settings = settings_record(5, &s_config);
+  persist_write_data(PERSIST_KEY_SETTINGS, &settings, sizeof(settings));
+  fake_counters_reset();
+  prv_init();
+
+  CHECK(get_slot_zone_id(1) == zone_id("Europe/London"));
+  CHECK(get_slot_zone_id(2) == zone_id("Asia/Tokyo"));
+  CHECK(active_timezone_count == 3);
+  CHECK(show_seconds && !always_show_home && seconds_window == 20);
+  CHECK(s_settings.colors[3] == 0x55AAFF);
+  CHECK(power_thresholds[0] == 30 && !power_save_asleep);
+  CHECK(s_config_revision == 5);
+  CHECK(fake_counters.persist_writes == 0);
+}
+
+// A record with a bad CRC is ignored: the watch starts with its defaults as if never
+// configured, so the phone's next blob is accepted only in full
+static void test_settings_bad_crc(void) {
+  Settings settings = settings_record(5, &s_config);
+  settings.crc ^= 1;
+  persist_write_data(PERSIST_KEY_SETTINGS, &settings, sizeof(settings));
+  prv_init();
+
+  CHECK(get_slot_zone_id(1) != zone_id("Europe/London"));
+  CHECK(!show_seconds && seconds_window == 0);
+  CHECK(s_settings.colors[3] == 0xAAAAAA);
+  CHECK(s_config_revision == 0);
+
+  send_config(CONFIG_SECTION_ZONES, 5, 6, &s_config);
+  CHECK(get_slot_zone_id(1) != zone_id("Europe/London"));
+}
+
+// The per-setting keys of earlier versions are read once, rewritten as a record and
+// deleted; zones may be stored by id or, older still, by name
+static void test_settings_legacy_migration(void) {
+  persist_write_int(PERSIST_KEY_ZONE_ID_BASE + 1, zone_id("Europe/London"));
+  persist_write_string(MESSAGE_KEY_TIMEZONE_1, "Asia/Tokyo");
+  persist_write_bool(MESSAGE_KEY_SHOW_SECONDS, true);
+  persist_write_int(MESSAGE_KEY_SECONDS_WINDOW, 15);
+  persist_write_int(MESSAGE_KEY_HOME_TIME_COLOR, 0x55AAFF);
+  persist_write_int(PERSIST_KEY_CONFIG_REVISION, 4);
+  prv_init();
+
+  CHECK(get_slot_zone_id(1) == zone_id("Europe/London"));
+  CHECK(get_slot_zone_id(2) == zone_id("Asia/Tokyo"));
+  CHECK(show_seconds && seconds_window == 15);
+  CHECK(s_settings.colors[3] == 0x55AAFF);
+  CHECK(s_config_revision == 4);
+  CHECK(!persist_exists(PERSIST_KEY_ZONE_ID_BASE + 1));
+  CHECK(!persist_exists(MESSAGE_KEY_TIMEZONE_1));
+  CHECK(!persist_exists(MESSAGE_KEY_SHOW_SECONDS));
+  CHECK(!persist_exists(PERSIST_KEY_CONFIG_REVISION));
+
+  Settings saved;
+  CHECK(persist_read_data(PERSIST_KEY_SETTINGS, &saved, sizeof(saved)) == (int)sizeof(saved));
+  CHECK(saved.zone_ids[1] == zone_id("Asia/Tokyo") && saved.config_revision == 4);
+  CHECK(saved.crc == crc32((const uint8_t *)&saved, sizeof(saved) - sizeof(saved.crc)));
+}
+
+// A first start with nothing persisted saves the defaults as a record, so the next one
+// reads the overlay, schedule and settings keys and probes no legacy key
+static void test_settings_cold_start(void) {
+  prv_init();
+  CHECK(persist_get_size(PERSIST_KEY_SETTINGS) == (int)sizeof(Settings));
+  int zone_ids[MAX_TIMEZONES];
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    zone_ids[slot] = get_slot_zone_id(slot);
+  }
+
+  fake_counters_reset();
+  load_saved_config();
+  CHECK(fake_counters.persist_reads == 3);
+  CHECK(fake_counters.persist_writes == 0);
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    CHECK(get_slot_zone_id(slot) == zone_ids[slot]);
+  }
+}
+
+// One zone's entry in an offset schedule, offsets in quarter hours
+typedef struct {
+  const char *zone;
+  int8_t offset;
+  uint8_t change_count;
+  struct {
+    uint16_t quarter;
+    int8_t offset;
+  } changes[4];
+} TestScheduleZone;
+
+// Encodes a schedule as zoneSchedule() in index.js does; returns its length
+static uint16_t schedule_blob(uint8_t *out, time_t start, uint16_t span,
+                              const TestScheduleZone *zones, int zone_count) {
+  uint8_t *end = out;
+  *end++ = SCHEDULE_VERSION;
+  *end++ = zone_count;
+  for (int i = 0; i < 4; i++) {
+    *end++ = ((uint32_t)start >> (8 * i)) & 0xFF;
+  }
+  *end++ = span & 0xFF;
+  *end++ = span >> 8;
+  for (int zone = 0; zone < zone_count; zone++) {
+    uint16_t id = zone_id(zones[zone].zone);
+    *end++ = id & 0xFF;
+    *end++ = id >> 8;
+    *end++ = (uint8_t)zones[zone].offset;
+    *end++ = zones[zone].change_count;
+    for (int i = 0; i < zones[zone].change_count; i++) {
+      *end++ = zones[zone].changes[i].quarter & 0xFF;
+      *end++ = zones[zone].changes[i].quarter >> 8;
+      *end++ = (uint8_t)zones[zone].changes[i].offset;
+    }
+  }
+  return (uint16_t)(end - out);
+}
+
+// Tokyo at +10:00, moving to +10:15 half an hour after TEST_EPOCH, for two hours from
+// an hour before it: offsets the built-in rules (+09:00) would never give
+static const TestScheduleZone s_tokyo_schedule = {"Asia/Tokyo", 40, 1, {{6, 41}}};
+#define SCHEDULE_START (TEST_EPOCH - 3600)
+#define SCHEDULE_SPAN 8
+
+// A schedule answers for its zones while it covers the time, and the built-in rules
+// answer for other zones and after it ends
+static void test_schedule_drives_offset(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &s_config);
+  uint8_t blob[SCHEDULE_MAX_SIZE];
+  deliver(MESSAGE_KEY_SCHEDULE, blob,
+          schedule_blob(blob, SCHEDULE_START, SCHEDULE_SPAN, &s_tokyo_schedule, 1));
+
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 600);
+  CHECK(get_slot_offset(2, TEST_EPOCH + 1800) == 615);
+  CHECK(get_slot_offset(2, TEST_EPOCH + 3600) == 540);
+  CHECK(get_slot_offset(1, TEST_EPOCH) == 60);
+  current_timezone_index = 2;
+  update_time_display();
+  CHECK_SCREEN("Tokyo (GMT +10:00) | 04:40 | Home: 19:40");
+}
+
+// A schedule that fails validation is dropped whole, leaving the previous one in use
+static void test_schedule_invalid_ignored(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &s_config);
+  uint8_t blob[SCHEDULE_MAX_SIZE];
+  TestScheduleZone unordered = {"Asia/Tokyo", 40, 2, {{6, 41}, {4, 40}}};
+  fake_counters_reset();
+  deliver(MESSAGE_KEY_SCHEDULE, blob, schedule_blob(blob, SCHEDULE_START, SCHEDULE_SPAN, &unordered, 1));
+  TestScheduleZone past_span = {"Asia/Tokyo", 40, 1, {{SCHEDULE_SPAN, 41}}};
+  deliver(MESSAGE_KEY_SCHEDULE, blob, schedule_blob(blob, SCHEDULE_START, SCHEDULE_SPAN, &past_span, 1));
+  uint16_t length = schedule_blob(blob, SCHEDULE_START, SCHEDULE_SPAN, &s_tokyo_schedule, 1);
+  deliver(MESSAGE_KEY_SCHEDULE, blob, length - 1);
+
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 540);
+  CHECK(fake_counters.persist_writes == 0);
+}
+
+// A received schedule is persisted as sent and used again from the next startup
+static void test_schedule_persisted(void) {
+  uint8_t blob[SCHEDULE_MAX_SIZE];
+  uint16_t length = schedule_blob(blob, SCHEDULE_START, SCHEDULE_SPAN, &s_tokyo_schedule, 1);
+  prv_init();
+  deliver(MESSAGE_KEY_SCHEDULE, blob, length);
+  uint8_t saved[SCHEDULE_MAX_SIZE];
+  CHECK(persist_read_data(PERSIST_KEY_SCHEDULE, saved, sizeof(saved)) == length);
+  CHECK(memcmp(saved, blob, length) == 0);
+
+  // Startup reads the schedule before the slots, which find their zones in it as set
+  fake_persist_reset();
+  Settings settings = settings_record(1, &s_config);
+  persist_write_data(PERSIST_KEY_SETTINGS, &settings, sizeof(settings));
+  persist_write_data(PERSIST_KEY_SCHEDULE, blob, length);
+  memset(s_schedule, 0, sizeof(s_schedule));
+  prv_init();
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 600);
+}
+
+// One overlay record: a zone's replacement base offset in minutes and rule
+typedef struct {
+  const char *zone;
+  int16_t offset;
+  uint8_t rule;
+} TestOverlayRecord;
+
+// Encodes an overlay in the order given; returns its length
+static uint16_t overlay_blob(uint8_t *out, const TestOverlayRecord *records, int count) {
+  uint8_t *end = out;
+  *end++ = OVERLAY_VERSION;
+  *end++ = count;
+  for (int i = 0; i < count; i++) {
+    uint16_t id = zone_id(records[i].zone);
+    *end++ = id & 0xFF;
+    *end++ = id >> 8;
+    *end++ = (uint16_t)records[i].offset & 0xFF;
+    *end++ = (uint16_t)records[i].offset >> 8;
+    *end++ = records[i].rule;
+  }
+  return (uint16_t)(end - out);
+}
+
+// A record replaces its zone's offset and rule, is persisted and applies again at
+// startup; an empty overlay restores the compiled table
+static void test_overlay_changes_offset(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &s_config);
+  uint8_t blob[OVERLAY_MAX_SIZE];
+  TestOverlayRecord tokyo = {"Asia/Tokyo", 600, DST_RULE_NONE};
+  uint16_t length = overlay_blob(blob, &tokyo, 1);
+  deliver(MESSAGE_KEY_OVERLAY, blob, length);
+
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 600);
+  CHECK(get_slot_offset(1, TEST_EPOCH) == 60);
+  current_timezone_index = 2;
+  update_time_display();
+  CHECK_SCREEN("Tokyo (GMT +10:00) | 04:40 | Home: 19:40");
+  uint8_t saved[OVERLAY_MAX_SIZE];
+  CHECK(persist_read_data(PERSIST_KEY_OVERLAY, saved, sizeof(saved)) == length);
+  CHECK(memcmp(saved, blob, length) == 0);
+
+  deliver(MESSAGE_KEY_OVERLAY, blob, overlay_blob(blob, NULL, 0));
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 540);
+
+  fake_persist_reset();
+  Settings settings = settings_record(1, &s_config);
+  persist_write_data(PERSIST_KEY_SETTINGS, &settings, sizeof(settings));
+  persist_write_data(PERSIST_KEY_OVERLAY, saved, length);
+  memset(s_overlay, 0, sizeof(s_overlay));
+  prv_init();
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 600);
+}
+
+// An overlay with an unknown rule, records out of id order or an offset out of range
+// is dropped whole
+static void test_overlay_invalid_rejected(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &s_config);
+  uint8_t blob[OVERLAY_MAX_SIZE];
+  fake_counters_reset();
+
+  TestOverlayRecord bad_rule = {"Asia/Tokyo", 600, TZ_RULE_COUNT};
+  deliver(MESSAGE_KEY_OVERLAY, blob, overlay_blob(blob, &bad_rule, 1));
+  TestOverlayRecord out_of_range = {"Asia/Tokyo", OVERLAY_MAX_OFFSET + 1, DST_RULE_NONE};
+  deliver(MESSAGE_KEY_OVERLAY, blob, overlay_blob(blob, &out_of_range, 1));
+  bool tokyo_first = zone_id("Asia/Tokyo") > zone_id("Europe/London");
+  TestOverlayRecord unordered[2] = {
+    {tokyo_first ? "Asia/Tokyo" : "Europe/London", 600, DST_RULE_NONE},
+    {tokyo_first ? "Europe/London" : "Asia/Tokyo", 600, DST_RULE_NONE},
+  };
+  deliver(MESSAGE_KEY_OVERLAY, blob, overlay_blob(blob, unordered, 2));
+
+  CHECK(get_slot_offset(2, TEST_EPOCH) == 540);
+  CHECK(get_slot_offset(1, TEST_EPOCH) == 60);
+  CHECK(fake_counters.persist_writes == 0);
+}
+
+// put_clock() against strftime, and snprintf for the unpadded 12-hour hour, over
+// midnight, noon and single-digit fields in both styles, with and without seconds
+static void test_format_clock(void) {
+  static const int times[][3] = {
+    {0, 0, 0}, {0, 5, 9}, {1, 0, 59}, {9, 7, 3}, {10, 10, 10}, {11, 59, 59},
+    {12, 0, 0}, {12, 30, 45}, {13, 1, 2}, {20, 9, 0}, {23, 59, 59},
+  };
+  for (size_t i = 0; i < ARRAY_LENGTH(times); i++) {
+    struct tm tm = {.tm_hour = times[i][0], .tm_min = times[i][1], .tm_sec = times[i][2]};
+    for (int style = 0; style < 4; style++) {
+      bool is_24h = style & 1;
+      bool with_seconds = style & 2;
+      char expected[32];
+      if (is_24h) {
+        strftime(expected, sizeof(expected), with_seconds ? "%H:%M:%S" : "%H:%M", &tm);
+      } else {
+        char minutes[16];
+        strftime(minutes, sizeof(minutes), with_seconds ? "%M:%S %p" : "%M %p", &tm);
+        snprintf(expected, sizeof(expected), "%d:%s", (tm.tm_hour + 11) % 12 + 1, minutes);
+      }
+      char text[32];
+      *put_clock(text, is_24h, tm.tm_hour, tm.tm_min, tm.tm_sec, with_seconds) = '\0';
+      CHECK(strcmp(text, expected) == 0);
+    }
+  }
+}
+
+// put_utc_offset() and put_zone_label() against snprintf, including offsets under an
+// hour either side of GMT and negative half and quarter hours
+static void test_format_offset(void) {
+  static const int offsets[] = {0, 30, -30, -45, 60, -60, 330, 345, -210, -570, 840, -720};
+  for (size_t i = 0; i < ARRAY_LENGTH(offsets); i++) {
+    int offset = offsets[i];
+    char expected[32];
+    snprintf(expected, sizeof(expected), "%c%02d:%02d", offset < 0 ? '-' : '+', abs(offset) / 60,
+             abs(offset) % 60);
+    char text[32];
+    *put_utc_offset(text, offset) = '\0';
+    CHECK(strcmp(text, expected) == 0);
+
+    char label[sizeof(tz_label)];
+    put_zone_label(label, sizeof(label), 0, offset);
+    char expected_label[64];
+    snprintf(expected_label, sizeof(expected_label), "%s (GMT %s)", get_slot_display_name(0, NULL), expected);
+    CHECK(strcmp(label, expected_label) == 0);
+  }
+}
+
+// Window x of a seconds line's layer, under either renderer
+static int seconds_layer_x(DisplayLine line) {
+#if SINGLE_LAYER_RENDERER
+  return layer_get_frame(line_layer(line)).origin.x;
+#else
+  return layer_get_frame(text_layer_get_layer(s_line_layers[line])).origin.x;
+#endif
+}
+
+// Seconds go on their own layer, placed from the cached glyph widths where the ':'
+// before them falls in the centered whole string; a seconds tick then patches only that
+// layer's text and leaves the minute text alone
+static void test_seconds_layer_split(void) {
+  prv_init();
+  TestConfig config = s_config;
+  config.display_flags |= CONFIG_FLAG_SHOW_SECONDS;
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &config);
+  CHECK(strcmp(time_buffer, "18:40") == 0 && strcmp(seconds_buffer, ":00") == 0);
+
+  // The fake lays out every glyph 8 pixels wide
+  GRect frame = s_line_frames[LINE_TIME];
+  int split_x = frame.origin.x + (frame.size.w - 8 * (int)strlen("18:40:00")) / 2 + 8 * (int)strlen("18:40");
+  CHECK(seconds_layer_x(LINE_TIME_SECONDS) == split_x);
+  GlyphWidths *widths = glyph_widths_for(s_line_fonts[LINE_TIME]);
+  CHECK(widths->widths['4' - GLYPH_FIRST] == 8 && widths->widths[':' - GLYPH_FIRST] == 8);
+
+  fake_counters_reset();
+  fake_clock_set(TEST_EPOCH + 1);
+  fake_tick(SECOND_UNIT);
+  CHECK(strcmp(time_buffer, "18:40") == 0 && strcmp(seconds_buffer, ":01") == 0);
+  CHECK(fake_counters.text_updates == 0 && fake_counters.dirty_marks == 1);
+  CHECK(seconds_layer_x(LINE_TIME_SECONDS) == split_x);
+  CHECK_SCREEN("local (GMT +00:00) | 18:40 | Home: 19:40 | :01");
+}
+
+// With a seconds window, seconds tick only after a tap (the face) or a button press
+// (the app), until the window's app_timer fires; another press meanwhile extends the
+// window rather than starting a second timer
+static void test_seconds_window_timer(void) {
+  prv_init();
+  TestConfig config = s_config;
+  config.display_flags |= CONFIG_FLAG_SHOW_SECONDS;
+  config.seconds_window = 10;
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &config);
+  CHECK(fake_tick_units() == MINUTE_UNIT && fake_timer_count() == 0);
+
+  // Each app ignores the other's input
+  fake_tap();
+  fake_click(BUTTON_ID_SELECT);
+  CHECK(fake_tick_units() == SECOND_UNIT && fake_timer_count() == 1);
+  CHECK(strcmp(seconds_buffer, ":00") == 0);
+  fake_tap();
+  fake_click(BUTTON_ID_SELECT);
+  CHECK(fake_timer_count() == 1);
+
+  CHECK(fake_timer_fire() == 10 * 1000);
+  CHECK(fake_tick_units() == MINUTE_UNIT && fake_timer_count() == 0 && !s_seconds_timer);
+  CHECK(!seconds_live());
+}
+
+static void set_battery(uint8_t percent, bool charging) {
+  fake_battery_set((BatteryChargeState) { .charge_percent = percent, .is_charging = charging });
+}
+
+// Seconds always on, and sleep left out so only the battery drives the governor
+static const TestConfig s_seconds_config = {
+  .zones = {"Europe/London", "Asia/Tokyo"},
+  .display_flags = CONFIG_FLAG_SHOW_SECONDS | CONFIG_FLAG_ALWAYS_SHOW_HOME,
+  .colors = {0x000055, 0xFFFFFF, 0xAAAAAA, 0x55AAFF},
+  .thresholds = {30, 20, 10},
+};
+
+// Each battery threshold steps the tier down and the tick subscription with it, and
+// the charger restores everything whatever the charge
+static void test_power_battery_tiers(void) {
+  prv_init();
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &s_seconds_config);
+  CHECK(s_power_tier == POWER_TIER_FULL && fake_tick_units() == SECOND_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18:40 | Home: 19:40 | :00");
+
+  set_battery(30, false);
+  CHECK(s_power_tier == POWER_TIER_NO_SECONDS && fake_tick_units() == MINUTE_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18:40 | Home: 19:40");
+  set_battery(20, false);
+  CHECK(s_power_tier == POWER_TIER_FROZEN_HOME && fake_tick_units() == MINUTE_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18:40 | Home (GMT +01:00)");
+  set_battery(10, false);
+  CHECK(s_power_tier == POWER_TIER_HOURLY && fake_tick_units() == HOUR_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18");
+
+  set_battery(10, true);
+  CHECK(s_power_tier == POWER_TIER_FULL && fake_tick_units() == SECOND_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18:40 | Home: 19:40 | :00");
+}
+
+// In the hourly tier a configured zone whose hour starts on the half hour keeps minute
+// ticks, whichever zone is shown, so its hour changes on time; with only whole-hour
+// zones configured the tier goes back to hour ticks
+static void test_power_hourly_half_hour_zone(void) {
+  prv_init();
+  TestConfig config = s_seconds_config;
+  config.zones[1] = "Asia/Kolkata";
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &config);
+  set_battery(5, false);
+  CHECK(s_power_tier == POWER_TIER_HOURLY && fake_tick_units() == MINUTE_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18");
+
+  current_timezone_index = 2;
+  update_time_display();
+  CHECK(fake_tick_units() == MINUTE_UNIT);
+  CHECK_SCREEN("Kolkata (GMT +05:30) | 00");
+  fake_clock_set(TEST_EPOCH + 50 * 60);  // 19:30 UTC, 01:00 in Kolkata
+  fake_tick(MINUTE_UNIT);
+  CHECK_SCREEN("Kolkata (GMT +05:30) | 01");
+
+  send_config(CONFIG_SECTIONS_ALL, 0, 2, &s_seconds_config);
+  CHECK(fake_tick_units() == HOUR_UNIT);
+}
+
+// Quiet Time has no event: it is noticed on the next minute tick, not on seconds ticks
+static void test_power_quiet_time_polled(void) {
+  prv_init();
+  TestConfig config = s_seconds_config;
+  config.power_flags = CONFIG_FLAG_SAVE_ASLEEP;
+  send_config(CONFIG_SECTIONS_ALL, 0, 1, &config);
+  fake_quiet_time_set(true);
+
+  fake_tick(SECOND_UNIT);
+  CHECK(s_power_tier == POWER_TIER_FULL && fake_tick_units() == SECOND_UNIT);
+  fake_clock_set(TEST_EPOCH + 60);
+  fake_tick(SECOND_UNIT | MINUTE_UNIT);
+  CHECK(s_power_tier == POWER_TIER_FROZEN_HOME && fake_tick_units() == MINUTE_UNIT);
+  CHECK_SCREEN("local (GMT +00:00) | 18:41 | Home (GMT +01:00)");
+
+  fake_quiet_time_set(false);
+  fake_clock_set(TEST_EPOCH + 120);
+  fake_tick(MINUTE_UNIT);
+  CHECK(s_power_tier == POWER_TIER_FULL && fake_tick_units() == SECOND_UNIT);
+}
+
+typedef struct {
+  const char *name;
+  void (*run)(void);
+} Test;
+
+static const Test s_tests[] = {
+  {"config_full_blob", test_config_full_blob},
+  {"config_bad_length", test_config_bad_length},
+  {"config_delta", test_config_delta},
+  {"config_wrong_base", test_config_wrong_base},
+  {"config_revision_check", test_config_revision_check},
+  {"settings_record_loads", test_settings_record_loads},
+  {"settings_bad_crc", test_settings_bad_crc},
+  {"settings_legacy_migration", test_settings_legacy_migration},
+  {"settings_cold_start", test_settings_cold_start},
+  {"schedule_drives_offset", test_schedule_drives_offset},
+  {"schedule_invalid_ignored", test_schedule_invalid_ignored},
+  {"schedule_persisted", test_schedule_persisted},
+  {"overlay_changes_offset", test_overlay_changes_offset},
+  {"overlay_invalid_rejected", test_overlay_invalid_rejected},
+  {"format_clock", test_format_clock},
+  {"format_offset", test_format_offset},
+  {"seconds_layer_split", test_seconds_layer_split},
+  {"seconds_window_timer", test_seconds_window_timer},
+  {"power_battery_tiers", test_power_battery_tiers},
+  {"power_hourly_half_hour_zone", test_power_hourly_half_hour_zone},
+  {"power_quiet_time_polled", test_power_quiet_time_polled},
+};
+
+int main(int argc, char **argv) {
+  setenv("TZ", "UTC", 1);
+  tzset();
+  fake_resource_set_dir(APP_RESOURCE_DIR);
+
+  int run = 0;
+  int failed = 0;
+  for (size_t i = 0; i < ARRAY_LENGTH(s_tests); i++) {
+    const Test *test = &s_tests[i];
+    if (argc > 1 && !strstr(test->name, argv[1])) {
+      continue;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+      fake_clock_set(TEST_EPOCH);
+      test->run();
+      exit(s_failures ? 1 : 0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+    bool passed = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    printf("%-32s %s\n", test->name, passed ? "ok" : "FAILED");
+    run++;
+    failed += !passed;
+  }
+  printf("%d of %d tests passed\n", run - failed, run);
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,302 @@
+// Differential check of the watch's DST engine against the host's zoneinfo. For every
+// zone in the TIMEZONE_DB resource and every step (default 15 minutes) from 1990 to
+// 2050, the offset the watch would show is compared with the one libc computes from
+// /usr/share/zoneinfo.
+//
+// libc's time zone is process-wide (TZ), so the work is spread over forked worker
+// processes that pull zones from a shared counter, one per core by default.
+//
+// Usage: verify [-j workers] [-f first_year] [-l last_year] [-s step_minutes] [-v]
+//
+// Mismatches inside the years the transition tables were generated for
+// (TZ_TRANSITION_FIRST_YEAR..TZ_TRANSITION_LAST_YEAR) are errors and make the exit
+// status non-zero. Outside that window the watch holds the nearest table's offset, so
+// mismatches there are only counted.
+#include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "fake_pebble.h"
+
+#define main app_main
+#include APP_MAIN
+#undef main
+
+#define ZONEINFO_DIR "/usr/share/zoneinfo"
+#define TRUTH_SCAN_STEP (24 * 60 * 60)
+
+typedef struct {
+  uint64_t samples;
+  uint64_t errors;          // mismatches inside the table window
+  uint64_t outside;         // mismatches outside the table window
+  int64_t first_error_utc;
+  int16_t first_error_engine;
+  int16_t first_error_truth;
+  bool skipped;             // no TZif file on this host
+} ZoneResult;
+
+typedef struct {
+  volatile uint32_t next_zone;
+  ZoneResult zones[SHARED_TIMEZONE_COUNT];
+} SharedState;
+
+// A host-side offset change: from utc on, the zone is utoff_minutes from UTC
+typedef struct {
+  int64_t utc;
+  int utoff_minutes;
+} Change;
+
+static int64_t s_range_start;
+static int64_t s_range_end;
+static int64_t s_window_start;
+static int64_t s_window_end;
+static int s_step_seconds = 15 * 60;
+
+static int64_t utc_of_year(int year) {
+  struct tm tm = {0};
+  tm.tm_year = year - 1900;
+  tm.tm_mday = 1;
+  return (int64_t)timegm(&tm);
+}
+
+static int host_offset_minutes(int64_t utc) {
+  time_t t = (time_t)utc;
+  struct tm tm;
+  localtime_r(&t, &tm);
+  return (int)(tm.tm_gmtoff / 60);
+}
+
+// Every offset change in [s_range_start, s_range_end) under the current TZ. The zone is
+// sampled daily and each change is bisected to the second, so this assumes a zone never
+// changes its offset and back again within one day.
+static Change *host_changes(int *count) {
+  int capacity = 256;
+  Change *changes = malloc(capacity * sizeof(Change));
+  *count = 0;
+  int64_t t = s_range_start;
+  int offset = host_offset_minutes(t);
+  changes[(*count)++] = (Change){t, offset};
+  while (t < s_range_end) {
+    int64_t next = t + TRUTH_SCAN_STEP;
+    if (host_offset_minutes(next) == offset) {
+      t = next;
+      continue;
+    }
+    // First second after t with a different offset
+    int64_t lo = t;
+    int64_t hi = next;
+    while (hi - lo > 1) {
+      int64_t mid = lo + (hi - lo) / 2;
+      if (host_offset_minutes(mid) == offset) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    offset = host_offset_minutes(hi);
+    if (*count == capacity) {
+      capacity *= 2;
+      changes = realloc(changes, capacity * sizeof(Change));
+    }
+    changes[(*count)++] = (Change){hi, offset};
+    t = hi;
+  }
+  return changes;
+}
+
+// Full identifier ("America/New_York") of a database row
+static void row_identifier(int row, char *buffer, size_t size) {
+  TzDbRow db_row;
+  char prefix[TZ_DB_MAX_STRING];
+  char name[TZ_DB_MAX_STRING];
+  tz_db_load_row(row, &db_row);
+  tz_db_load_string(tz_db_read_u16(TZ_DB_PREFIXES_OFFSET + db_row.prefix_index * 2), prefix);
+  tz_db_load_string(db_row.name_offset, name);
+  snprintf(buffer, size, "%s%s", prefix, name);
+}
+
+static void verify_zone(int row, ZoneResult *result) {
+  TzDbRow db_row;
+  char identifier[2 * TZ_DB_MAX_STRING];
+  char path[sizeof(ZONEINFO_DIR) + sizeof(identifier)];
+  tz_db_load_row(row, &db_row);
+  row_identifier(row, identifier, sizeof(identifier));
+
+  // libc silently falls back to UTC for an unknown zone, so check the file first
+  snprintf(path, sizeof(path), "%s/%s", ZONEINFO_DIR, identifier);
+  if (access(path, R_OK) != 0) {
+    result->skipped = true;
+    return;
+  }
+  setenv("TZ", identifier, 1);
+  tzset();
+
+  int change_count;
+  Change *changes = host_changes(&change_count);
+  int change = 0;
+
+  // Evaluate the engine the way get_slot_offset() does: only when utc leaves the
+  // interval the previous answer was valid for
+  time_t valid_from = 0;
+  time_t valid_until = 0;
+  int engine = 0;
+  for (int64_t utc = s_range_start; utc < s_range_end; utc += s_step_seconds) {
+    if (utc < valid_from || (utc >= valid_until && valid_until != INT32_MAX)) {
+      engine = get_dst_adjusted_offset(db_row.dst_rule, db_row.offset_minutes, (time_t)utc,
+                                       &valid_from, &valid_until);
+    }
+    while (change + 1 < change_count && changes[change + 1].utc <= utc) {
+      change++;
+    }
+    int truth = changes[change].utoff_minutes;
+    result->samples++;
+    if (engine == truth) {
+      continue;
+    }
+    if (utc >= s_window_start && utc < s_window_end) {
+      if (result->errors++ == 0) {
+        result->first_error_utc = utc;
+        result->first_error_engine = engine;
+        result->first_error_truth = truth;
+      }
+    } else {
+      result->outside++;
+    }
+  }
+  free(changes);
+}
+
+static void worker(SharedState *state) {
+  for (;;) {
+    uint32_t row = __sync_fetch_and_add(&state->next_zone, 1);
+    if (row >= SHARED_TIMEZONE_COUNT) {
+      return;
+    }
+    verify_zone(row, &state->zones[row]);
+  }
+}
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void format_utc(int64_t utc, char *buffer, size_t size) {
+  time_t t = (time_t)utc;
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  strftime(buffer, size, "%Y-%m-%d %H:%M", &tm);
+}
+
+int main(int argc, char **argv) {
+  int workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  int first_year = 1990;
+  int last_year = 2050;
+  bool verbose = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "j:f:l:s:v")) != -1) {
+    switch (opt) {
+      case 'j': workers = atoi(optarg); break;
+      case 'f': first_year = atoi(optarg); break;
+      case 'l': last_year = atoi(optarg); break;
+      case 's': s_step_seconds = atoi(optarg) * 60; break;
+      case 'v': verbose = true; break;
+      default:
+        fprintf(stderr, "Usage: %s [-j workers] [-f first_year] [-l last_year] [-s step_minutes] [-v]\n", argv[0]);
+        return 2;
+    }
+  }
+  if (workers < 1) {
+    workers = 1;
+  }
+  if (s_step_seconds <= 0 || last_year < first_year) {
+    fprintf(stderr, "Invalid range or step\n");
+    return 2;
+  }
+
+  s_range_start = utc_of_year(first_year);
+  s_range_end = utc_of_year(last_year + 1);
+  s_window_start = utc_of_year(TZ_TRANSITION_FIRST_YEAR);
+  s_window_end = utc_of_year(TZ_TRANSITION_LAST_YEAR + 1);
+
+  fake_resource_set_dir(APP_RESOURCE_DIR);
+  resource_get_handle(RESOURCE_ID_TIMEZONE_DB);  // load before forking
+
+  SharedState *state = mmap(NULL, sizeof(SharedState), PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (state == MAP_FAILED) {
+    perror("mmap");
+    return 1;
+  }
+  memset(state, 0, sizeof(SharedState));
+
+  uint64_t begin = now_ns();
+  for (int i = 0; i < workers; i++) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      worker(state);
+      _exit(0);
+    } else if (pid < 0) {
+      perror("fork");
+      return 1;
+    }
+  }
+  int failed_workers = 0;
+  for (int i = 0; i < workers; i++) {
+    int status;
+    wait(&status);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      failed_workers++;
+    }
+  }
+  double seconds = (now_ns() - begin) / 1e9;
+
+  uint64_t samples = 0;
+  uint64_t errors = 0;
+  uint64_t outside = 0;
+  int error_zones = 0;
+  int outside_zones = 0;
+  int skipped = 0;
+  for (int row = 0; row < SHARED_TIMEZONE_COUNT; row++) {
+    ZoneResult *zone = &state->zones[row];
+    samples += zone->samples;
+    errors += zone->errors;
+    outside += zone->outside;
+    skipped += zone->skipped;
+    outside_zones += zone->outside > 0;
+    if (zone->errors || (verbose && (zone->outside || zone->skipped))) {
+      char identifier[2 * TZ_DB_MAX_STRING];
+      row_identifier(row, identifier, sizeof(identifier));
+      if (zone->skipped) {
+        printf("%-32s no zoneinfo on this host, skipped\n", identifier);
+        continue;
+      }
+      printf("%-32s %" PRIu64 " mismatches in window, %" PRIu64 " outside", identifier,
+             zone->errors, zone->outside);
+      if (zone->errors) {
+        char when[32];
+        format_utc(zone->first_error_utc, when, sizeof(when));
+        printf("; first at %s UTC: watch %+d min, zoneinfo %+d min", when,
+               zone->first_error_engine, zone->first_error_truth);
+        error_zones++;
+      }
+      printf("\n");
+    }
+  }
+
+  printf("Checked %d zones (%d skipped), %d..%d every %d min: %" PRIu64 " samples\n",
+         SHARED_TIMEZONE_COUNT - skipped, skipped, first_year, last_year, s_step_seconds / 60, samples);
+  printf("Table window %d..%d: %" PRIu64 " mismatches in %d zones\n",
+         TZ_TRANSITION_FIRST_YEAR, TZ_TRANSITION_LAST_YEAR, errors, error_zones);
+  printf("Outside window: %" PRIu64 " mismatches in %d zones (expected; the watch holds the nearest table entry)\n",
+         outside, outside_zones);
+  printf("%d workers, %.2f s, %.1f M samples/s\n", workers, seconds, samples / seconds / 1e6);
+
+  if (failed_workers) {
+    fprintf(stderr, "%d worker(s) failed\n", failed_workers);
+    return 1;
+  }
+  return errors ? 1 : 0;
+}
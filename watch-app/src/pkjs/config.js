@@ -1,24 +1,32 @@
-// Dynamically generated config will be produced at runtime by index.js
-// This file exports a function that accepts a list of timezone option objects
-module.exports = function(build_options) {
-  // build_options is an array of {label, value}
+// Clay config page. The zone fields are text inputs holding the zone identifier, each
+// turned into a searchable picker by picker.js, which gets the zone list once.
+module.exports = function() {
   return [
     { "type": "heading", "defaultValue": "Timezone Traveler Settings" },
     { "type": "text", "defaultValue": "Configure your 6 timezones and appearance settings.\nAuthor: kinncj (https://github.com/kinncj/pebble-traveler)" },
     { "type": "section", "items": [
       { "type": "heading", "defaultValue": "Home Timezone" },
-      { "type": "select", "messageKey": "HOME", "defaultValue": "", "label": "Home Timezone", "options": [{ "label": "None", "value": "" }].concat(build_options) },
+      { "type": "input", "messageKey": "HOME", "defaultValue": "", "label": "Home Timezone", "attributes": { "placeholder": "None" } },
       { "type": "heading", "defaultValue": "Additional Timezones" },
-      { "type": "select", "messageKey": "TIMEZONE_1", "defaultValue": "", "label": "Timezone 3", "options": [{ "label": "None", "value": "" }].concat(build_options) },
-      { "type": "select", "messageKey": "TIMEZONE_2", "defaultValue": "", "label": "Timezone 4", "options": [{ "label": "None", "value": "" }].concat(build_options) },
-      { "type": "select", "messageKey": "TIMEZONE_3", "defaultValue": "", "label": "Timezone 5", "options": [{ "label": "None", "value": "" }].concat(build_options) },
-      { "type": "select", "messageKey": "TIMEZONE_4", "defaultValue": "", "label": "Timezone 6", "options": [{ "label": "None", "value": "" }].concat(build_options) }
+      { "type": "input", "messageKey": "TIMEZONE_1", "defaultValue": "", "label": "Timezone 3", "attributes": { "placeholder": "None" } },
+      { "type": "input", "messageKey": "TIMEZONE_2", "defaultValue": "", "label": "Timezone 4", "attributes": { "placeholder": "None" } },
+      { "type": "input", "messageKey": "TIMEZONE_3", "defaultValue": "", "label": "Timezone 5", "attributes": { "placeholder": "None" } },
+      { "type": "input", "messageKey": "TIMEZONE_4", "defaultValue": "", "label": "Timezone 6", "attributes": { "placeholder": "None" } }
     ]},
     { "type": "section", "items": [
       { "type": "heading", "defaultValue": "Display Options" },
       { "type": "toggle", "messageKey": "ALWAYS_SHOW_HOME", "defaultValue": false, "label": "Always Display Home Timezone?", "description": "When enabled, the home timezone will always be shown on the watch face regardless of navigation" },
       { "type": "toggle", "messageKey": "SHOW_SECONDS", "defaultValue": false, "label": "Show Seconds (Main Time)", "description": "Display seconds for the current timezone" },
-      { "type": "toggle", "messageKey": "SHOW_HOME_SECONDS", "defaultValue": false, "label": "Show Seconds (Home Time)", "description": "Display seconds for the home timezone when visible" }
+      { "type": "toggle", "messageKey": "SHOW_HOME_SECONDS", "defaultValue": false, "label": "Show Seconds (Home Time)", "description": "Display seconds for the home timezone when visible" },
+      { "type": "slider", "messageKey": "SECONDS_WINDOW", "defaultValue": 30, "min": 0, "max": 120, "step": 5, "label": "Seconds After Button Press (s)", "description": "Show seconds only for this long after a button press, then tick once a minute to save battery. 0 keeps seconds on all the time." }
+    ] },
+    { "type": "section", "items": [
+      { "type": "heading", "defaultValue": "Battery Saver" },
+      { "type": "text", "defaultValue": "As the battery drains the watch steps down to save power. Each level applies at or below its charge; 0 turns it off. Everything is restored while charging." },
+      { "type": "slider", "messageKey": "POWER_NO_SECONDS_BELOW", "defaultValue": 30, "min": 0, "max": 100, "step": 10, "label": "Hide Seconds Below (%)" },
+      { "type": "slider", "messageKey": "POWER_FREEZE_HOME_BELOW", "defaultValue": 20, "min": 0, "max": 100, "step": 10, "label": "Freeze Home Time Below (%)", "description": "The home line shows its GMT offset instead of a ticking time" },
+      { "type": "slider", "messageKey": "POWER_HOURLY_BELOW", "defaultValue": 10, "min": 0, "max": 100, "step": 10, "label": "Hourly Updates Below (%)", "description": "Only the hour is shown and updated; the home line is hidden" },
+      { "type": "toggle", "messageKey": "POWER_SAVE_ASLEEP", "defaultValue": true, "label": "Save Power While Asleep", "description": "Hide seconds and freeze the home time during Quiet Time or while sleep is detected" }
     ] },
     { "type": "section", "items": [
       { "type": "heading", "defaultValue": "Color Settings" },
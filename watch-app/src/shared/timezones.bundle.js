@@ -0,0 +1,2 @@
+// Generated by utility/timezone_tool.py from timezones.canonical.json; do not edit
+module.exports={"zones":"Africa*Abidjan~0!Accra~0!Addis_Ababa~180!Algiers~60!Asmara~180!Asmera~180!Bamako~0!Bangui~60!Banjul~0!Bissau~0!Blantyre~120!Brazzaville~60!Bujumbura~120!Cairo~120!Casablanca~60!Ceuta~60!Conakry~0!Dakar~0!Dar_es_Salaam~180!Djibouti~180!Douala~60!El_Aaiun~60!Freetown~0!Gaborone~120!Harare~120!Johannesburg~120!Juba~120!Kampala~180!Khartoum~120!Kigali~120!Kinshasa~60!Lagos~60!Libreville~60!Lome~0!Luanda~60!Lubumbashi~120!Lusaka~120!Malabo~60!Maputo~120!Maseru~120!Mbabane~120!Mogadishu~180!Monrovia~0!Nairobi~180!Ndjamena~60!Niamey~60!Nouakchott~0!Ouagadougou~0!Porto-Novo~60!Sao_Tome~0!Timbuktu~0!Tripoli~120!Tunis~60!Windhoek~120.America*Adak~-600!Anchorage~-540!Argentina/Buenos_Aires~-180!Atka~-600!Boise~-420!Chicago~-360!Danmarkshavn~0!Denver~-420!Detroit~-300!Edmonton~-420!Fort_Wayne~-300!Indiana/Indianapolis~-300!Indiana/Knox~-360!Indiana/Marengo~-300!Indiana/Petersburg~-300!Indiana/Tell_City~-360!Indiana/Vevay~-300!Indiana/Vincennes~-300!Indiana/Winamac~-300!Juneau~-540!Kentucky/Louisville~-300!Kentucky/Monticello~-300!Knox_IN~-360!Los_Angeles~-480!Louisville~-300!Menominee~-360!Metlakatla~-540!Mexico_City~-360!Montreal~-300!New_York~-300!Nome~-540!North_Dakota/Beulah~-360!North_Dakota/Center~-360!North_Dakota/New_Salem~-360!Phoenix~-420!Regina~-360!Sao_Paulo~-180!Toronto~-300!Winnipeg~-360!Yakutat~-540.Antarctica*Casey~480!Davis~420!DumontDUrville~600!Macquarie~600!Mawson~300!McMurdo~720!South_Pole~720!Syowa~180!Troll~0!Vostok~300.Arctic*Longyearbyen~60.Asia*Aden~180!Almaty~300!Amman~180!Anadyr~720!Aqtau~300!Aqtobe~300!Ashgabat~300!Ashkhabad~300!Atyrau~300!Baghdad~180!Bahrain~180!Baku~240!Bangkok~420!Barnaul~420!Beirut~120!Bishkek~360!Brunei~480!Calcutta~330!Chita~540!Choibalsan~480!Chongqing~480!Chungking~480!Colombo~330!Dacca~360!Damascus~180!Dhaka~360!Dili~540!Dubai~240!Dushanbe~300!Famagusta~120!Gaza~120!Harbin~480!Hebron~120!Ho_Chi_Minh~420!Hong_Kong~480!Hovd~420!Irkutsk~480!Istanbul~180!Jakarta~420!Jayapura~540!Jerusalem~120!Kabul~270!Kamchatka~720!Karachi~300!Kashgar~360!Kathmandu~345!Katmandu~345!Khandyga~540!Kolkata~330!Krasnoyarsk~420!Kuala_Lumpur~480!Kuching~480!Kuwait~180!Macao~480!Macau~480!Magadan~660!Makassar~480!Manila~480!Muscat~240!Nicosia~120!Novokuznetsk~420!Novosibirsk~420!Omsk~360!Oral~300!Phnom_Penh~420!Pontianak~420!Pyongyang~540!Qatar~180!Qostanay~300!Qyzylorda~300!Rangoon~390!Riyadh~180!Saigon~420!Sakhalin~660!Samarkand~300!Seoul~540!Shanghai~480!Singapore~480!Srednekolymsk~660!Taipei~480!Tashkent~300!Tbilisi~240!Tehran~210!Tel_Aviv~120!Thimbu~360!Thimphu~360!Tokyo~540!Tomsk~420!Ujung_Pandang~480!Ulaanbaatar~480!Ulan_Bator~480!Urumqi~360!Ust-Nera~600!Vientiane~420!Vladivostok~600!Yakutsk~540!Yangon~390!Yekaterinburg~300!Yerevan~240.Atlantic*Azores~0!Canary~0!Faeroe~0!Faroe~0!Jan_Mayen~60!Madeira~0!Reykjavik~0!St_Helena~0.Australia*ACT~600!Adelaide~570!Brisbane~600!Broken_Hill~570!Canberra~600!Currie~600!Darwin~570!Eucla~525!Hobart~600!LHI~630!Lindeman~600!Lord_Howe~630!Melbourne~600!NSW~600!North~570!Perth~480!Queensland~600!South~570!Sydney~600!Tasmania~600!Victoria~600!West~480!Yancowinna~570.Etc*GMT~0!GMT-0~0!GMT-1~60!GMT-10~600!GMT-11~660!GMT-12~720!GMT-13~780!GMT-14~840!GMT-2~120!GMT-3~180!GMT-4~240!GMT-5~300!GMT-6~360!GMT-7~420!GMT-8~480!GMT-9~540!GMT0~0!Greenwich~0!UCT~0!UTC~0!Universal~0!Zulu~0.Europe*Amsterdam~60!Andorra~60!Astrakhan~240!Athens~120!Belfast~0!Belgrade~60!Berlin~60!Bratislava~60!Brussels~60!Bucharest~120!Budapest~60!Busingen~60!Chisinau~120!Copenhagen~60!Dublin~0!Gibraltar~60!Guernsey~0!Helsinki~120!Isle_of_Man~0!Istanbul~180!Jersey~0!Kaliningrad~120!Kiev~120!Kirov~180!Kyiv~120!Lisbon~0!Ljubljana~60!London~0!Luxembourg~60!Madrid~60!Malta~60!Mariehamn~120!Minsk~180!Monaco~60!Moscow~180!Nicosia~120!Oslo~60!Paris~60!Podgorica~60!Prague~60!Riga~120!Rome~60!Samara~240!San_Marino~60!Sarajevo~60!Saratov~240!Simferopol~180!Skopje~60!Sofia~120!Stockholm~60!Tallinn~120!Tirane~60!Tiraspol~120!Ulyanovsk~240!Uzhgorod~120!Vaduz~60!Vatican~60!Vienna~60!Vilnius~120!Volgograd~180!Warsaw~60!Zagreb~60!Zaporozhye~120!Zurich~60.Indian*Antananarivo~180!Chagos~360!Christmas~420!Cocos~390!Comoro~180!Kerguelen~300!Mahe~240!Maldives~300!Mauritius~240!Mayotte~180!Reunion~240.Pacific*Apia~780!Auckland~720!Bougainville~660!Chatham~765!Chuuk~600!Efate~660!Enderbury~780!Fakaofo~780!Fiji~720!Funafuti~720!Guadalcanal~660!Guam~600!Honolulu~-600!Kanton~780!Kiritimati~840!Kosrae~660!Kwajalein~720!Majuro~720!Nauru~720!Norfolk~660!Noumea~660!Palau~540!Pohnpei~660!Ponape~660!Port_Moresby~600!Saipan~600!Tarawa~720!Tongatapu~780!Truk~600!Wake~720!Wallis~720!Yap~600.US*Alaska~-540!Aleutian~-600!Arizona~-420!Central~-360!Eastern~-300!Hawaii~-600!Indiana-Starke~-360!Michigan~-300!Mountain~-420!Pacific~-480","ids":[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,60,76,85,94,104,107,108,110,115,129,130,131,132,133,134,135,136,142,143,144,145,149,150,160,162,163,168,171,173,175,176,177,183,193,201,216,221,222,224,225,226,227,228,229,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,247,248,249,250,251,252,253,254,255,256,257,258,259,260,261,262,263,264,265,266,267,268,269,270,271,272,273,274,275,276,277,278,279,280,281,282,283,284,285,286,287,288,289,290,291,292,293,294,295,296,297,298,299,300,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321,322,323,324,325,326,327,328,329,330,331,332,333,334,335,336,338,340,341,342,343,344,346,348,349,350,351,352,353,354,355,356,357,358,359,360,362,361,363,364,365,366,367,368,369,370,388,389,390,391,392,393,394,395,396,397,398,399,400,401,402,403,404,405,406,408,407,409,410,411,412,386,413,414,415,416,383,417,418,419,420,421,387,422,423,424,425,426,427,428,429,430,431,432,433,434,435,436,437,438,439,440,441,442,443,444,445,446,447,448,449,450,451,452,453,454,455,456,457,458,459,460,461,462,463,464,465,466,467,468,469,470,472,473,474,475,476,477,478,479,480,481,482,489,487,490,488,491,493,494,495,496,497,500,501,471,503,504,505,483,506,509,511,512,514,516,517,518,520,523,524,525,526,527,528,529,530,531,532,534,535,536,537,538,539],"hash":"949adc4e"};
@@ -8,36 +8,96 @@ typedef long time_t;
 #endif
 
 #define MAX_TIMEZONES 6  // Local + GMT + 4 configurable
-#define TZ_NAME_LENGTH 20
+#define TZ_INDEX_NONE 0xFFFF  // Slot without a zone table row (Local, or unconfigured)
+#define TZ_FLAG_ENABLED 0x01
+#define PERSIST_KEY_SETTINGS 120  // The Settings record, see save_settings()
+#define PERSIST_KEY_SCHEDULE 121  // The phone's offset schedule, see get_scheduled_offset()
+#define PERSIST_KEY_OVERLAY 122  // The phone's zone table corrections, see find_overlay_record()
+// Per-setting layout, read once to migrate to PERSIST_KEY_SETTINGS: the message keys,
+// plus these
+#define PERSIST_KEY_ZONE_ID_BASE 100  // + slot: zone id for slots 1-5
+#define PERSIST_KEY_CONFIG_REVISION 110  // Revision of the last applied config blob
+
+// Renderer, chosen at build time: 0 draws the label, time and home lines with three
+// TextLayers; 1 draws them from one Layer's update_proc, which saves the TextLayers'
+// heap and redraws the whole text block from a single dirty mark
+#ifndef SINGLE_LAYER_RENDERER
+#define SINGLE_LAYER_RENDERER 0
+#endif
 
 static Window *s_window;
-static TextLayer *s_timezone_layer;
-static TextLayer *s_time_layer;
-static TextLayer *s_home_time_layer;  // For displaying home timezone
+#if SINGLE_LAYER_RENDERER
+static Layer *s_canvas_layer;  // Spans the three text lines, see canvas_update_proc()
+static Layer *s_seconds_layers[2];  // Seconds of the time and home lines
+#else
+static TextLayer *s_line_layers[5];  // One per DisplayLine
+#endif
 // s_hint_layer removed
 
-// Timezone data structure
+// Timezone slot: a zone database row plus flags. The row's name, offset and rule are
+// read from the TIMEZONE_DB resource when needed rather than copied into the slot.
 typedef struct {
-  char name[TZ_NAME_LENGTH];
-  char display_name[TZ_NAME_LENGTH];
-  int offset_minutes; // offset from UTC in minutes
-  bool enabled;
+  uint16_t tz_index;
+  uint8_t flags;
 } Timezone;
 
+// One row of the TIMEZONE_DB resource (see utility/timezone_tool.py for the layout)
+typedef struct {
+  uint16_t id;
+  int16_t offset_minutes;
+  uint8_t dst_rule;
+  uint8_t prefix_index;
+  uint16_t name_offset;
+  uint16_t display_offset;
+} TzDbRow;
+
+// Cached DST-adjusted offset of a slot, valid for UTC times in [valid_from, valid_until)
+typedef struct {
+  int16_t offset_minutes;
+  time_t valid_from;
+  time_t valid_until;
+} OffsetCache;
+
 // Default timezones: Local is always enabled, Home and 4 additional slots
 static Timezone timezones[MAX_TIMEZONES] = {
-  {"Local", "Local", 0, true},        // 1. Local (GPS-based)
-  {"", "Home", 0, false},             // 2. Home (user configurable)
-  {"", "", 0, false},                 // 3. Timezone 3 (user configurable)
-  {"", "", 0, false},                 // 4. Timezone 4 (user configurable)
-  {"", "", 0, false},                 // 5. Timezone 5 (user configurable)
-  {"", "", 0, false}                  // 6. Timezone 6 (user configurable)
+  {.tz_index = TZ_INDEX_NONE, .flags = TZ_FLAG_ENABLED},  // 1. Local (GPS-based)
+  {.tz_index = TZ_INDEX_NONE},                            // 2. Home (user configurable)
+  {.tz_index = TZ_INDEX_NONE},                            // 3. Timezone 3 (user configurable)
+  {.tz_index = TZ_INDEX_NONE},                            // 4. Timezone 4 (user configurable)
+  {.tz_index = TZ_INDEX_NONE},                            // 5. Timezone 5 (user configurable)
+  {.tz_index = TZ_INDEX_NONE}                             // 6. Timezone 6 (user configurable)
 };
 
+static OffsetCache s_offset_cache[MAX_TIMEZONES];
+static ResHandle s_tz_db;
+
 static int current_timezone_index = 0;
 static int active_timezone_count = 1;  // Start with just Local
 static bool always_show_home = false;  // Always display home timezone option
-static int num_timezone_configs = SHARED_TIMEZONE_COUNT;
+
+// Everything the phone configures, persisted as one record under PERSIST_KEY_SETTINGS,
+// so a cold start costs one flash read and a config change one write. The record is
+// always written whole; a wrong version or CRC makes load_settings() ignore it.
+#define SETTINGS_VERSION 1
+#define SETTINGS_FLAG_ALWAYS_SHOW_HOME 0x01
+#define SETTINGS_FLAG_SHOW_SECONDS 0x02
+#define SETTINGS_FLAG_SHOW_HOME_SECONDS 0x04
+#define SETTINGS_FLAG_SAVE_ASLEEP 0x08
+
+typedef struct {
+  uint8_t version;                        // SETTINGS_VERSION
+  uint8_t flags;                          // SETTINGS_FLAG_*
+  uint8_t seconds_window;
+  uint8_t power_thresholds[3];
+  uint16_t config_revision;
+  uint16_t zone_ids[MAX_TIMEZONES - 1];   // Slots 1-5
+  uint8_t reserved[2];                    // Zero; keeps the layout free of padding
+  uint32_t colors[4];                     // 0xRRGGBB: background, time, label, home time
+  uint32_t crc;                           // crc32() of everything before it
+} Settings;
+
+// Colors as configured, in hex: GColors on black-and-white watches can't be mapped back
+static Settings s_settings = { .colors = {0x000000, 0xFFFFFF, 0xAAAAAA, 0xAAAAAA} };
 
 // Appearance settings
 static GColor background_color;
@@ -46,633 +106,1423 @@ static GColor timezone_label_color;
 static GColor home_time_color;
 static bool show_seconds = false;
 static bool show_home_seconds = false;
+static int seconds_window = 0;  // Seconds shown for this long after a tap, 0 = always
+static AppTimer *s_seconds_timer;  // Running while the seconds window is open
+static TimeUnits s_tick_units;  // Current tick_timer_service subscription
 
-// Helper function to determine if DST is active for US timezones
-static bool is_dst_active_us(struct tm *tm) {
-  // DST in US: Second Sunday in March to First Sunday in November
-  // This is a simplified calculation for 2024 onwards
+// Power governor: as the battery drains, or while the wearer sleeps, the clock steps
+// down through these tiers, each waking the CPU and redrawing less than the last
+typedef enum {
+  POWER_TIER_FULL,         // As configured
+  POWER_TIER_NO_SECONDS,   // Minute ticks, seconds off
+  POWER_TIER_FROZEN_HOME,  // Minute ticks; the home line shows its offset, not its time
+  POWER_TIER_HOURLY        // Hour ticks; the time line shows just the hour, home hidden
+} PowerTier;
+static int power_thresholds[3] = {30, 20, 10};  // Battery % at or below which tiers 1-3 apply, 0 = never
+static bool power_save_asleep = true;  // At least POWER_TIER_FROZEN_HOME in Quiet Time or sleep
+static PowerTier s_power_tier = POWER_TIER_FULL;
+static BatteryChargeState s_battery = { .charge_percent = 100 };
+
+// Helper function to get DST-adjusted offset for a timezone at a UTC instant.
+// Binary-searches the zone's precompiled transition rule (see utility/timezone_tool.py)
+// and reports the UTC interval [*valid_from, *valid_until) over which the result holds.
+static int get_dst_adjusted_offset(uint8_t dst_rule, int base_offset_minutes, time_t utc,
+                                   time_t *valid_from, time_t *valid_until) {
+  *valid_from = INT32_MIN;
+  *valid_until = INT32_MAX;
+  if (dst_rule >= TZ_RULE_COUNT) {
+    return base_offset_minutes;
+  }
   
-  int month = tm->tm_mon + 1;  // tm_mon is 0-11, we need 1-12
-  int day = tm->tm_mday;
-  int wday = tm->tm_wday;  // 0=Sunday, 1=Monday, ..., 6=Saturday
+  const TzRule *rule = &TZ_RULES[dst_rule];
+  const int32_t *times = &TZ_TRANSITION_TIMES[rule->start];
   
-  // Before March or after November - no DST
-  if (month < 3 || month > 11) {
-    return false;
+  // Find the number of transitions at or before utc
+  int lo = 0;
+  int hi = rule->count;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (times[mid] <= utc) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
   }
   
-  // April to October - always DST
-  if (month > 3 && month < 11) {
-    return true;
+  if (lo < rule->count) {
+    *valid_until = times[lo];
   }
-  
-  // March - DST starts on second Sunday
-  if (month == 3) {
-    // Find second Sunday of March
-    // First Sunday is between 1st and 7th
-    // Second Sunday is between 8th and 14th
-    int second_sunday = 8 + ((7 - wday + day) % 7);
-    if (second_sunday > 14) second_sunday -= 7;
-    return day >= second_sunday;
+  if (lo == 0) {
+    return base_offset_minutes;  // Before the first transition: base offset
   }
-  
-  // November - DST ends on first Sunday
-  if (month == 11) {
-    // Find first Sunday of November
-    int first_sunday = 1 + ((7 - wday + day) % 7);
-    if (first_sunday > 7) first_sunday -= 7;
-    return day < first_sunday;
+  *valid_from = times[lo - 1];
+  return base_offset_minutes + TZ_TRANSITION_DELTAS[rule->start + lo - 1];
+}
+
+// Zone database reads. The table lives in the TIMEZONE_DB raw resource and only the
+// bytes a lookup touches are loaded, so the catalog costs no resident memory.
+static void tz_db_read(uint32_t offset, uint8_t *buffer, size_t length) {
+  if (!s_tz_db) {
+    s_tz_db = resource_get_handle(RESOURCE_ID_TIMEZONE_DB);
   }
-  
-  return false;
+  resource_load_byte_range(s_tz_db, offset, buffer, length);
 }
 
-// Helper function to determine if DST is active for EU timezones
-static bool is_dst_active_eu(struct tm *tm) {
-  // DST in EU: Last Sunday in March to Last Sunday in October
-  
-  int month = tm->tm_mon + 1;  // tm_mon is 0-11, we need 1-12
-  int day = tm->tm_mday;
-  int wday = tm->tm_wday;  // 0=Sunday, 1=Monday, ..., 6=Saturday
-  
-  // Before March or after October - no DST
-  if (month < 3 || month > 10) {
+static uint16_t tz_db_read_u16(uint32_t offset) {
+  uint8_t bytes[2];
+  tz_db_read(offset, bytes, sizeof(bytes));
+  return bytes[0] | (bytes[1] << 8);
+}
+
+static void tz_db_load_row(int row, TzDbRow *out) {
+  uint8_t bytes[TZ_DB_ROW_SIZE];
+  tz_db_read(TZ_DB_ROWS_OFFSET + row * TZ_DB_ROW_SIZE, bytes, sizeof(bytes));
+  out->id = bytes[0] | (bytes[1] << 8);
+  out->offset_minutes = (int16_t)(bytes[2] | (bytes[3] << 8));
+  out->dst_rule = bytes[4];
+  out->prefix_index = bytes[5];
+  out->name_offset = bytes[6] | (bytes[7] << 8);
+  out->display_offset = bytes[8] | (bytes[9] << 8);
+}
+
+// Copy a NUL-terminated string from the database into buffer[TZ_DB_MAX_STRING]
+static void tz_db_load_string(uint16_t offset, char *buffer) {
+  tz_db_read(TZ_DB_STRINGS_OFFSET + offset, (uint8_t *)buffer, TZ_DB_MAX_STRING);
+  buffer[TZ_DB_MAX_STRING - 1] = '\0';
+}
+
+// Offset schedule computed by the phone from its own IANA rules for the configured zones
+// (SCHEDULE message key), kept as received and persisted under PERSIST_KEY_SCHEDULE.
+// Little-endian layout:
+//   version, zone count, uint32 start (UTC), uint16 span in quarter hours
+//   per zone: uint16 zone id, int8 offset at start in quarter hours, change count,
+//             then per change: uint16 quarter hours after start, int8 new offset
+// Changes are ascending and inside the span. A zone missing from it, or a time outside
+// [start, start + span), is answered by the built-in rules.
+#define SCHEDULE_VERSION 1
+#define SCHEDULE_HEADER_SIZE 8
+#define SCHEDULE_ZONE_HEADER_SIZE 4
+#define SCHEDULE_CHANGE_SIZE 3
+#define SCHEDULE_MAX_CHANGES 8  // Per zone; a year has at most four in practice
+#define SCHEDULE_MAX_SIZE (SCHEDULE_HEADER_SIZE + (MAX_TIMEZONES - 1) * \
+                           (SCHEDULE_ZONE_HEADER_SIZE + SCHEDULE_MAX_CHANGES * SCHEDULE_CHANGE_SIZE))
+#define QUARTER_HOUR_SECONDS (15 * 60)
+
+static uint8_t s_schedule[SCHEDULE_MAX_SIZE];
+static uint16_t s_schedule_zone[MAX_TIMEZONES];  // Each slot's zone entry in s_schedule, 0 = none
+
+static uint16_t read_u16(const uint8_t *data) {
+  return data[0] | (data[1] << 8);
+}
+
+static uint32_t read_u32(const uint8_t *data) {
+  return read_u16(data) | ((uint32_t)read_u16(data + 2) << 16);
+}
+
+// Position of a zone's entry in s_schedule, 0 if the schedule has none
+static uint16_t find_schedule_zone(uint16_t id) {
+  uint16_t position = SCHEDULE_HEADER_SIZE;
+  for (int zone = 0; zone < s_schedule[1]; zone++) {
+    if (read_u16(s_schedule + position) == id) {
+      return position;
+    }
+    position += SCHEDULE_ZONE_HEADER_SIZE + s_schedule[position + 3] * SCHEDULE_CHANGE_SIZE;
+  }
+  return 0;
+}
+
+// Offset of a slot's zone from the phone's schedule, with the UTC interval
+// [*valid_from, *valid_until) it holds for. False when the schedule does not cover
+// the zone at utc, which includes every time after it expires.
+static bool get_scheduled_offset(int slot, time_t utc, int *offset_minutes,
+                                 time_t *valid_from, time_t *valid_until) {
+  uint16_t position = s_schedule_zone[slot];
+  if (position == 0) {
     return false;
   }
-  
-  // April to September - always DST
-  if (month > 3 && month < 10) {
-    return true;
+  time_t start = read_u32(s_schedule + 2);
+  time_t end = start + read_u16(s_schedule + 6) * QUARTER_HOUR_SECONDS;
+  if (utc < start || utc >= end) {
+    return false;
   }
   
-  // March - DST starts on last Sunday
-  if (month == 3) {
-    // Find last Sunday of March (25th-31st)
-    int last_sunday = 31 - ((wday + 31 - day) % 7);
-    return day >= last_sunday;
-  }
+  const uint8_t *zone = s_schedule + position;
+  const uint8_t *changes = zone + SCHEDULE_ZONE_HEADER_SIZE;
+  int count = zone[3];
+  uint16_t quarter = (utc - start) / QUARTER_HOUR_SECONDS;
   
-  // October - DST ends on last Sunday
-  if (month == 10) {
-    // Find last Sunday of October (25th-31st)
-    int last_sunday = 31 - ((wday + 31 - day) % 7);
-    return day < last_sunday;
+  // Find the number of changes at or before utc
+  int lo = 0;
+  int hi = count;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (read_u16(changes + mid * SCHEDULE_CHANGE_SIZE) <= quarter) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
   }
   
-  return false;
+  *valid_from = start;
+  *valid_until = end;
+  int8_t quarters = (int8_t)zone[2];
+  if (lo > 0) {
+    const uint8_t *change = changes + (lo - 1) * SCHEDULE_CHANGE_SIZE;
+    *valid_from = start + read_u16(change) * QUARTER_HOUR_SECONDS;
+    quarters = (int8_t)change[2];
+  }
+  if (lo < count) {
+    *valid_until = start + read_u16(changes + lo * SCHEDULE_CHANGE_SIZE) * QUARTER_HOUR_SECONDS;
+  }
+  *offset_minutes = quarters * 15;
+  return true;
+}
+
+// Corrections to the compiled zone table from the phone (OVERLAY message key), kept as
+// received and persisted under PERSIST_KEY_OVERLAY. Layout:
+//   version, record count
+//   per record, by ascending zone id: uint16 zone id, int16 base offset in minutes,
+//                                     uint8 rule (TZ_RULES index, DST_RULE_NONE = fixed)
+// A record replaces its row's offset and rule wherever get_slot_offset() reads the row,
+// so the per-tick lookups are the same with or without an overlay.
+#define OVERLAY_VERSION 1
+#define OVERLAY_HEADER_SIZE 2
+#define OVERLAY_RECORD_SIZE 5
+#define OVERLAY_MAX_RECORDS 24
+#define OVERLAY_MAX_SIZE (OVERLAY_HEADER_SIZE + OVERLAY_MAX_RECORDS * OVERLAY_RECORD_SIZE)
+#define OVERLAY_MAX_OFFSET (16 * 60)
+
+static uint8_t s_overlay[OVERLAY_MAX_SIZE];  // Record count 0 = no overlay
+
+// A zone's overlay record, or NULL if the overlay leaves it alone
+static const uint8_t *find_overlay_record(uint16_t id) {
+  int lo = 0;
+  int hi = s_overlay[1];
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    const uint8_t *record = s_overlay + OVERLAY_HEADER_SIZE + mid * OVERLAY_RECORD_SIZE;
+    uint16_t record_id = read_u16(record);
+    if (record_id == id) {
+      return record;
+    } else if (record_id < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return NULL;
 }
 
-// Helper function to determine if DST is active for Australian timezones
-static bool is_dst_active_au(struct tm *tm) {
-  // DST in Australia: First Sunday in October to First Sunday in April (next year)
+// DST-adjusted offset for a configured slot, from the phone's schedule while it covers
+// utc and from the built-in rules otherwise. The cached value is only re-evaluated once
+// utc leaves its validity interval: at the next transition, when the schedule expires,
+// or when the clock jumps.
+static int get_slot_offset(int slot, time_t utc) {
+  OffsetCache *cache = &s_offset_cache[slot];
+  if (utc < cache->valid_from || utc >= cache->valid_until) {
+    int offset_minutes;
+    if (get_scheduled_offset(slot, utc, &offset_minutes, &cache->valid_from, &cache->valid_until)) {
+      cache->offset_minutes = offset_minutes;
+    } else {
+      TzDbRow db_row;
+      tz_db_load_row(timezones[slot].tz_index, &db_row);
+      const uint8_t *record = find_overlay_record(db_row.id);
+      if (record) {
+        db_row.offset_minutes = (int16_t)read_u16(record + 2);
+        db_row.dst_rule = record[4];
+      }
+      cache->offset_minutes = get_dst_adjusted_offset(db_row.dst_rule, db_row.offset_minutes,
+                                                      utc, &cache->valid_from, &cache->valid_until);
+      // A schedule that has yet to start takes over when it does, and one that has
+      // ended again if the clock is set back into it
+      if (s_schedule_zone[slot] != 0) {
+        time_t schedule_start = read_u32(s_schedule + 2);
+        time_t schedule_end = schedule_start + read_u16(s_schedule + 6) * QUARTER_HOUR_SECONDS;
+        if (utc < schedule_start && schedule_start < cache->valid_until) {
+          cache->valid_until = schedule_start;
+        } else if (utc >= schedule_end && schedule_end > cache->valid_from) {
+          cache->valid_from = schedule_end;
+        }
+      }
+    }
+  }
+  return cache->offset_minutes;
+}
+
+static bool is_slot_enabled(int slot) {
+  return (timezones[slot].flags & TZ_FLAG_ENABLED) != 0;
+}
+
+// Label for a slot: slot 0 is local time, slot 1 is always shown as "Home", others
+// are loaded into buffer[TZ_DB_MAX_STRING]
+static const char *get_slot_display_name(int slot, char *buffer) {
+  if (slot == 0) {
+    return "local";
+  }
+  if (slot == 1) {
+    return "Home";
+  }
+  TzDbRow db_row;
+  tz_db_load_row(timezones[slot].tz_index, &db_row);
+  tz_db_load_string(db_row.display_offset, buffer);
+  return buffer;
+}
+
+// Helper function to convert hex color to GColor
+static GColor hex_to_gcolor(uint32_t hex) {
+#ifdef PBL_COLOR
+  return GColorFromHEX(hex);
+#else
+  // For black and white platforms, map to appropriate grayscale
+  uint8_t r = (hex >> 16) & 0xFF;
+  uint8_t g = (hex >> 8) & 0xFF;
+  uint8_t b = hex & 0xFF;
+  uint8_t gray = (r + g + b) / 3;
+  return gray > 128 ? GColorWhite : GColorBlack;
+#endif
+}
+
+// Sets the color globals from s_settings.colors
+static void apply_setting_colors(void) {
+  background_color = hex_to_gcolor(s_settings.colors[0]);
+  time_color = hex_to_gcolor(s_settings.colors[1]);
+  timezone_label_color = hex_to_gcolor(s_settings.colors[2]);
+  home_time_color = hex_to_gcolor(s_settings.colors[3]);
+}
+
+// Initialize default colors
+static void init_default_colors() {
+  background_color = GColorBlack;
+  time_color = GColorWhite;
+#ifdef PBL_COLOR
+  timezone_label_color = GColorLightGray;
+  home_time_color = GColorLightGray;
+#else
+  timezone_label_color = GColorWhite;
+  home_time_color = GColorWhite;
+#endif
+}
+
+// Configuration functions
+
+// strcmp() of a row's full identifier (prefix + name) against identifier
+static int compare_identifier(int row, const char *identifier) {
+  TzDbRow db_row;
+  char text[TZ_DB_MAX_STRING];
+  tz_db_load_row(row, &db_row);
+  
+  tz_db_load_string(tz_db_read_u16(TZ_DB_PREFIXES_OFFSET + db_row.prefix_index * 2), text);
+  size_t prefix_len = strlen(text);
+  int cmp = strncmp(text, identifier, prefix_len);
+  if (cmp != 0) {
+    return cmp;
+  }
+  tz_db_load_string(db_row.name_offset, text);
+  return strcmp(text, identifier + prefix_len);
+}
+
+// Binary search of the database's by-identifier index; returns the row or -1
+static int find_timezone_by_identifier(const char *timezone_id) {
+  int lo = 0;
+  int hi = SHARED_TIMEZONE_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    int row = tz_db_read_u16(TZ_DB_BY_IDENTIFIER_OFFSET + mid * 2);
+    int cmp = compare_identifier(row, timezone_id);
+    if (cmp == 0) {
+      return row;
+    } else if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return -1;
+}
+
+// Binary search of the database rows, which are generated in id order; returns the row or -1
+static int find_timezone_by_id(int id) {
+  int lo = 0;
+  int hi = SHARED_TIMEZONE_COUNT - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    int mid_id = tz_db_read_u16(TZ_DB_ROWS_OFFSET + mid * TZ_DB_ROW_SIZE);
+    if (mid_id == id) {
+      return mid;
+    } else if (mid_id < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return -1;
+}
+
+// Numeric id of the zone a slot is set to, 0 if disabled
+static int get_slot_zone_id(int slot) {
+  if (!(timezones[slot].flags & TZ_FLAG_ENABLED) || timezones[slot].tz_index == TZ_INDEX_NONE) {
+    return 0;
+  }
+  return tz_db_read_u16(TZ_DB_ROWS_OFFSET + timezones[slot].tz_index * TZ_DB_ROW_SIZE);
+}
+
+// Point a slot at a zone table row, or disable it when row is -1
+static void set_slot_timezone(int slot, int row) {
+  if (slot < 1 || slot >= MAX_TIMEZONES) {
+    // APP_LOG(APP_LOG_LEVEL_WARNING, "Invalid slot %d, ignoring", slot);
+    return;  // Don't modify Local (slot 0)
+  }
   
-  int month = tm->tm_mon + 1;  // tm_mon is 0-11, we need 1-12
-  int day = tm->tm_mday;
-  int wday = tm->tm_wday;  // 0=Sunday, 1=Monday, ..., 6=Saturday
+  // Invalidate the cached offset so the next lookup re-evaluates it
+  s_offset_cache[slot].valid_from = 0;
+  s_offset_cache[slot].valid_until = 0;
   
-  // May to September - no DST
-  if (month >= 5 && month <= 9) {
-    return false;
+  if (row < 0) {
+    // Disable this timezone slot
+    timezones[slot].tz_index = TZ_INDEX_NONE;
+    timezones[slot].flags &= ~TZ_FLAG_ENABLED;
+    s_schedule_zone[slot] = 0;
+    // APP_LOG(APP_LOG_LEVEL_INFO, "Disabled timezone slot %d", slot);
+  } else {
+    timezones[slot].tz_index = row;
+    timezones[slot].flags |= TZ_FLAG_ENABLED;
+    s_schedule_zone[slot] = find_schedule_zone(get_slot_zone_id(slot));
+    //APP_LOG(APP_LOG_LEVEL_INFO, "Configured slot %d: row %d", slot, row);
   }
+}
+
+// Configure a slot from an identifier string (legacy path); "" disables it
+static void load_timezone_config(int slot, const char* timezone_id) {
+  // APP_LOG(APP_LOG_LEVEL_INFO, "load_timezone_config: slot=%d, timezone_id='%s'", slot, timezone_id);
   
-  // November to March - always DST
-  if (month >= 11 || month <= 3) {
-    return true;
+  if (strlen(timezone_id) == 0) {
+    set_slot_timezone(slot, -1);
+    return;
   }
   
-  // October - DST starts on first Sunday
-  if (month == 10) {
-    // Find first Sunday of October
-    int first_sunday = 1 + ((7 - wday + day) % 7);
-    if (first_sunday > 7) first_sunday -= 7;
-    return day >= first_sunday;
+  // Find the timezone configuration in the shared array
+  int row = find_timezone_by_identifier(timezone_id);
+  if (row >= 0) {
+    set_slot_timezone(slot, row);
+  }
+}
+
+// Configure a slot from its numeric zone id; 0 disables it
+static void load_timezone_config_id(int slot, int id) {
+  if (id == 0) {
+    set_slot_timezone(slot, -1);
+    return;
   }
   
-  // April - DST ends on first Sunday
-  if (month == 4) {
-    // Find first Sunday of April
-    int first_sunday = 1 + ((7 - wday + day) % 7);
-    if (first_sunday > 7) first_sunday -= 7;
-    return day < first_sunday;
+  int row = find_timezone_by_id(id);
+  if (row >= 0) {
+    set_slot_timezone(slot, row);
+  }
+}
+
+// AppMessage key for a configurable slot (HOME, then TIMEZONE_1..4)
+static uint32_t slot_message_key(int slot) {
+  return (slot == 1) ? MESSAGE_KEY_HOME : MESSAGE_KEY_TIMEZONE_1 + (slot - 2);
+}
+
+// Restore a slot from the per-setting layout: an id under PERSIST_KEY_ZONE_ID_BASE + slot,
+// or, from before numeric ids, the identifier string under the slot's message key
+static bool load_legacy_zone(int slot) {
+  uint32_t id_key = PERSIST_KEY_ZONE_ID_BASE + slot;
+  if (persist_exists(id_key)) {
+    load_timezone_config_id(slot, persist_read_int(id_key));
+    return true;
   }
   
+  char buffer[32];
+  if (persist_read_string(slot_message_key(slot), buffer, sizeof(buffer)) > 0) {
+    load_timezone_config(slot, buffer);
+    return true;
+  }
   return false;
 }
 
-// Helper function to determine if DST is active for Brazilian timezones
-static bool is_dst_active_br(struct tm *tm) {
-  // DST in Brazil: Third Sunday in October to Third Sunday in February (next year)
-  // Note: Brazil suspended DST in 2019, but keeping this for historical accuracy
-  
-  int month = tm->tm_mon + 1;  // tm_mon is 0-11, we need 1-12
-  int day = tm->tm_mday;
-  int wday = tm->tm_wday;  // 0=Sunday, 1=Monday, ..., 6=Saturday
-  
-  // March to September - no DST
-  if (month >= 3 && month <= 9) {
-    return false;
+static void update_active_timezone_count() {
+  active_timezone_count = 0;
+  for (int i = 0; i < MAX_TIMEZONES; i++) {
+    if (is_slot_enabled(i)) {
+      active_timezone_count++;
+    }
   }
   
-  // November to January - always DST
-  if (month >= 11 || month == 1) {
-    return true;
+  // Ensure current index is valid
+  if (current_timezone_index >= active_timezone_count) {
+    current_timezone_index = 0;
+  }
+}
+
+static int get_active_timezone_index(int display_index) {
+  int count = 0;
+  for (int i = 0; i < MAX_TIMEZONES; i++) {
+    if (is_slot_enabled(i)) {
+      if (count == display_index) {
+        return i;
+      }
+      count++;
+    }
+  }
+  return 0;  // Fallback to first timezone
+}
+
+// Clock state: what the current render was built from, so ticks only redo what changed
+typedef struct {
+  bool valid;                 // false forces a full refresh on the next update
+  int actual_tz_index;        // slot currently displayed
+  int local_offset_minutes;   // watch's own UTC offset
+  int main_offset_minutes;    // UTC offset of the displayed slot
+  int home_offset_minutes;    // UTC offset of the home slot
+  bool home_visible;
+  time_t valid_from;          // UTC interval the offsets above hold for
+  time_t valid_until;
+  int main_seconds_pos;       // index of the seconds digits in seconds_buffer, -1 if none
+  int home_seconds_pos;       // index of the seconds digits in home_seconds_buffer, -1 if none
+} ClockState;
+
+static ClockState s_clock;
+
+static char time_buffer[32];
+static char home_time_buffer[32];
+static char tz_label[64];  // Increased size to accommodate timezone name + GMT offset
+static char seconds_buffer[8];  // ":ss[ AM]" split off time_buffer while seconds are shown
+static char home_seconds_buffer[8];
+
+// Display lines, top to bottom. While seconds are shown, the time and home lines are
+// split in two: the line keeps "hh:mm" ("Home: hh:mm") and its seconds line, a separate
+// layer just to the right, holds ":ss[ AM]", so a seconds tick redraws only that layer.
+typedef enum {
+  LINE_LABEL,
+  LINE_TIME,
+  LINE_HOME,
+  LINE_TIME_SECONDS,
+  LINE_HOME_SECONDS,
+  LINE_COUNT
+} DisplayLine;
+
+#define SECONDS_LINE_OFFSET (LINE_TIME_SECONDS - LINE_TIME)  // LINE_TIME/HOME -> seconds line
+
+typedef struct {
+  char *text;
+  size_t size;
+} LineBuffer;
+
+static const LineBuffer s_line_buffers[LINE_COUNT] = {
+  {tz_label, sizeof(tz_label)},
+  {time_buffer, sizeof(time_buffer)},
+  {home_time_buffer, sizeof(home_time_buffer)},
+  {seconds_buffer, sizeof(seconds_buffer)},
+  {home_seconds_buffer, sizeof(home_seconds_buffer)},
+};
+
+// Unsplit frame (window coordinates) and font of each line, set up in prv_window_load
+static GRect s_line_frames[LINE_COUNT];
+static GFont s_line_fonts[LINE_COUNT];
+
+static GColor line_color(DisplayLine line) {
+  switch (line) {
+    case LINE_LABEL:
+      return timezone_label_color;
+    case LINE_TIME:
+    case LINE_TIME_SECONDS:
+      return time_color;
+    default:
+      return home_time_color;
+  }
+}
+
+#if SINGLE_LAYER_RENDERER
+#define CANVAS_TOP 35  // Window y of s_canvas_layer, the top of the label line
+
+// Where each line is drawn: frame in s_canvas_layer coordinates, alignment, visibility
+typedef struct {
+  GRect frame;
+  GTextAlignment alignment;
+  bool visible;
+} CanvasLine;
+
+static CanvasLine s_canvas_lines[LINE_COUNT];
+
+static void draw_line(GContext *ctx, DisplayLine line, GRect frame) {
+  if (!s_canvas_lines[line].visible) {
+    return;
   }
+  graphics_context_set_text_color(ctx, line_color(line));
+  graphics_draw_text(ctx, s_line_buffers[line].text, s_line_fonts[line], frame,
+                     GTextOverflowModeWordWrap, s_canvas_lines[line].alignment, NULL);
+}
+
+// Draws exactly what the TextLayers would: same frames, fonts, colors, alignment
+static void canvas_update_proc(Layer *layer, GContext *ctx) {
+  for (int line = LINE_LABEL; line <= LINE_HOME; line++) {
+    draw_line(ctx, line, s_canvas_lines[line].frame);
+  }
+}
+
+// Seconds lines are child layers of the canvas, each framed to its line
+static void seconds_update_proc(Layer *layer, GContext *ctx) {
+  DisplayLine line = (layer == s_seconds_layers[0]) ? LINE_TIME_SECONDS : LINE_HOME_SECONDS;
+  draw_line(ctx, line, layer_get_bounds(layer));
+}
+
+static Layer *line_layer(DisplayLine line) {
+  return line >= LINE_TIME_SECONDS ? s_seconds_layers[line - LINE_TIME_SECONDS] : s_canvas_layer;
+}
+
+// The label, time and home lines share the canvas, so all their changes in one event
+// coalesce into one redraw; a seconds tick marks only a seconds layer
+static void mark_line_dirty(DisplayLine line) {
+  Layer *layer = line_layer(line);
+  if (layer) {
+    layer_mark_dirty(layer);
+  }
+}
+#else
+static void mark_line_dirty(DisplayLine line) {
+  layer_mark_dirty(text_layer_get_layer(s_line_layers[line]));
+}
+#endif
+
+// Render diff: show `text` on a line, but only redraw when the content changed. Text is
+// formatted into a scratch buffer first and copied into the line's buffer.
+static void set_text_if_changed(DisplayLine line, const char *text) {
+  char *shown = s_line_buffers[line].text;
+#if SINGLE_LAYER_RENDERER
+  if (strcmp(shown, text) == 0) {
+    return;
+  }
+#else
+  TextLayer *layer = s_line_layers[line];
+  if (text_layer_get_text(layer) == shown && strcmp(shown, text) == 0) {
+    return;
+  }
+#endif
+  size_t length = strlen(text);
+  if (length >= s_line_buffers[line].size) {
+    length = s_line_buffers[line].size - 1;
+  }
+  memcpy(shown, text, length);
+  shown[length] = '\0';
+#if SINGLE_LAYER_RENDERER
+  mark_line_dirty(line);
+#else
+  text_layer_set_text(layer, shown);
+#endif
+}
+
+static void set_line_visible(DisplayLine line, bool visible) {
+#if SINGLE_LAYER_RENDERER
+  if (visible != s_canvas_lines[line].visible) {
+    s_canvas_lines[line].visible = visible;
+    mark_line_dirty(line);
+  }
+#else
+  layer_set_hidden(text_layer_get_layer(s_line_layers[line]), !visible);
+#endif
+}
+
+// Moves a line (frame in window coordinates). Nothing is redrawn unless it moved.
+static void set_line_layout(DisplayLine line, GRect frame, GTextAlignment alignment) {
+#if SINGLE_LAYER_RENDERER
+  CanvasLine *canvas_line = &s_canvas_lines[line];
+  frame.origin.y -= CANVAS_TOP;
+  if (canvas_line->alignment == alignment && grect_equal(&canvas_line->frame, &frame)) {
+    return;
+  }
+  canvas_line->frame = frame;
+  canvas_line->alignment = alignment;
+  if (line >= LINE_TIME_SECONDS) {
+    layer_set_frame(line_layer(line), frame);
+  }
+  mark_line_dirty(line);
+#else
+  Layer *layer = text_layer_get_layer(s_line_layers[line]);
+  GRect current = layer_get_frame(layer);
+  if (grect_equal(&current, &frame)) {
+    return;
+  }
+  layer_set_frame(layer, frame);
+  text_layer_set_text_alignment(s_line_layers[line], alignment);
+#endif
+}
+
+// Line colors live in the *_color globals; this only pushes a change to the screen,
+// including the line's seconds line
+static void set_line_color(DisplayLine line, GColor color) {
+  bool has_seconds_line = (line == LINE_TIME || line == LINE_HOME);
+#if SINGLE_LAYER_RENDERER
+  mark_line_dirty(line);
+  if (has_seconds_line) {
+    mark_line_dirty(line + SECONDS_LINE_OFFSET);
+  }
+#else
+  text_layer_set_text_color(s_line_layers[line], color);
+  if (has_seconds_line) {
+    text_layer_set_text_color(s_line_layers[line + SECONDS_LINE_OFFSET], color);
+  }
+#endif
+}
+
+// Advance widths of a font's printable ASCII glyphs, each measured on first use, so
+// splitting a line costs table lookups rather than a text layout pass
+#define GLYPH_FIRST ' '
+#define GLYPH_LAST '~'
+#define GLYPH_UNMEASURED 0xFF
+
+typedef struct {
+  GFont font;
+  uint8_t widths[GLYPH_LAST - GLYPH_FIRST + 1];
+} GlyphWidths;
+
+static GlyphWidths s_glyph_widths[2];  // The time font and GOTHIC_14
+
+static GlyphWidths *glyph_widths_for(GFont font) {
+  for (unsigned i = 0; i < ARRAY_LENGTH(s_glyph_widths); i++) {
+    GlyphWidths *cache = &s_glyph_widths[i];
+    if (!cache->font) {
+      cache->font = font;
+      memset(cache->widths, GLYPH_UNMEASURED, sizeof(cache->widths));
+    }
+    if (cache->font == font) {
+      return cache;
+    }
+  }
+  return &s_glyph_widths[0];
+}
+
+static int glyph_width(GlyphWidths *cache, unsigned char c) {
+  if (c < GLYPH_FIRST || c > GLYPH_LAST) {
+    c = '0';
+  }
+  uint8_t *width = &cache->widths[c - GLYPH_FIRST];
+  if (*width == GLYPH_UNMEASURED) {
+    // Measured in front of a '0' so a space is not trimmed away
+    const GRect box = GRect(0, 0, 200, 100);
+    char pair[3] = {c, '0', '\0'};
+    int pair_width = graphics_text_layout_get_content_size(pair, cache->font, box,
+                                                           GTextOverflowModeFill, GTextAlignmentLeft).w;
+    int zero_width = graphics_text_layout_get_content_size("0", cache->font, box,
+                                                           GTextOverflowModeFill, GTextAlignmentLeft).w;
+    *width = pair_width - zero_width;
+  }
+  return *width;
+}
+
+static int text_width(GlyphWidths *cache, const char *text, size_t length) {
+  int width = 0;
+  for (size_t i = 0; i < length && text[i]; i++) {
+    width += glyph_width(cache, text[i]);
+  }
+  return width;
+}
+
+// Shows a formatted time on LINE_TIME or LINE_HOME. With seconds_pos (the index of the
+// seconds digits in text) >= 0, the text from the ':' before them goes to the seconds
+// line, and the two frames meet where that ':' falls when the whole string is centered.
+// Returns the index of the seconds digits in the seconds line's buffer, or -1.
+static int show_time_line(DisplayLine line, const char *text, int seconds_pos) {
+  DisplayLine seconds_line = line + SECONDS_LINE_OFFSET;
+  GRect frame = s_line_frames[line];
+  if (seconds_pos < 1) {
+    set_line_visible(seconds_line, false);
+    set_line_layout(line, frame, GTextAlignmentCenter);
+    set_text_if_changed(line, text);
+    return -1;
+  }
+
+  size_t split = seconds_pos - 1;
+  char head[sizeof(time_buffer)];
+  if (split >= sizeof(head)) {
+    split = sizeof(head) - 1;
+  }
+  memcpy(head, text, split);
+  head[split] = '\0';
+
+  GlyphWidths *widths = glyph_widths_for(s_line_fonts[line]);
+  int head_width = text_width(widths, text, split);
+  int left = (frame.size.w - head_width - text_width(widths, text + split, SIZE_MAX)) / 2;
+  if (left < 0) {
+    left = 0;
+  }
+  int split_x = frame.origin.x + left + head_width;
+  set_line_layout(line, GRect(frame.origin.x, frame.origin.y, split_x - frame.origin.x, frame.size.h),
+                  GTextAlignmentRight);
+  set_line_layout(seconds_line, GRect(split_x, frame.origin.y, frame.origin.x + frame.size.w - split_x, frame.size.h),
+                  GTextAlignmentLeft);
+  set_text_if_changed(line, head);
+  set_text_if_changed(seconds_line, text + split);
+  set_line_visible(seconds_line, true);
+  return seconds_pos - split;
+}
+
+// snprintf-free formatting for the clock lines. Each put_* helper writes at `out` without
+// a terminator and returns the position after what it wrote; callers size the buffer
+// for the longest result and terminate it.
+static const char s_two_digits[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+static char *put_two_digits(char *out, int value) {
+  out[0] = s_two_digits[value * 2];
+  out[1] = s_two_digits[value * 2 + 1];
+  return out + 2;
+}
+
+static char *put_text(char *out, const char *text, size_t max_length) {
+  while (*text && max_length--) {
+    *out++ = *text++;
+  }
+  return out;
+}
+
+// "hh" in 24-hour style, "h" in 12-hour style
+static char *put_hour(char *out, bool is_24h, int hour) {
+  if (is_24h) {
+    return put_two_digits(out, hour);
+  }
+  int display_hour = hour % 12;
+  if (display_hour == 0) display_hour = 12;
+  if (display_hour >= 10) {
+    *out++ = '1';
+  }
+  *out++ = '0' + display_hour % 10;
+  return out;
+}
+
+// " AM" / " PM" in 12-hour style, nothing in 24-hour style
+static char *put_meridiem(char *out, bool is_24h, int hour) {
+  if (!is_24h) {
+    memcpy(out, hour >= 12 ? " PM" : " AM", 3);
+    out += 3;
+  }
+  return out;
+}
+
+// "hh:mm[:ss]" in 24-hour style, "h:mm[:ss] AM" in 12-hour style
+static char *put_clock(char *out, bool is_24h, int hour, int minute, int second, bool with_seconds) {
+  out = put_hour(out, is_24h, hour);
+  *out++ = ':';
+  out = put_two_digits(out, minute);
+  if (with_seconds) {
+    *out++ = ':';
+    out = put_two_digits(out, second);
+  }
+  return put_meridiem(out, is_24h, hour);
+}
+
+// "+hh:mm" / "-hh:mm"
+static char *put_utc_offset(char *out, int offset_minutes) {
+  int magnitude = abs(offset_minutes);
+  *out++ = offset_minutes < 0 ? '-' : '+';
+  out = put_two_digits(out, magnitude / 60);
+  *out++ = ':';
+  return put_two_digits(out, magnitude % 60);
+}
+
+// "Name (GMT +hh:mm)" into out[size], terminated
+static void put_zone_label(char *out, size_t size, int slot, int offset_minutes) {
+  char name[TZ_DB_MAX_STRING];
+  char *end = put_text(out, get_slot_display_name(slot, name), size - sizeof(" (GMT +hh:mm)"));
+  memcpy(end, " (GMT ", 6);
+  end = put_utc_offset(end + 6, offset_minutes);
+  *end++ = ')';
+  *end = '\0';
+}
+
+// The watch's own UTC offset in minutes, from its local time and the UTC epoch
+static int get_local_offset_minutes(struct tm *local_tm, time_t utc) {
+  int utc_minutes = (utc / 60) % (24 * 60);
+  int local_offset_minutes = local_tm->tm_hour * 60 + local_tm->tm_min - utc_minutes;
+  
+  // Handle day boundary crossings
+  if (local_offset_minutes > 12 * 60) {
+    local_offset_minutes -= 24 * 60;
+  } else if (local_offset_minutes < -12 * 60) {
+    local_offset_minutes += 24 * 60;
+  }
+  return local_offset_minutes;
+}
+
+// Defined with the tick handler: the hourly tier's units depend on the zone shown
+static void update_tick_subscription(void);
+
+// Hour/day work: resolve offsets for the displayed and home slots and rebuild the label
+static void refresh_zone_state(struct tm *local_tm) {
+  time_t temp = time(NULL);
+  int local_offset_minutes = get_local_offset_minutes(local_tm, temp);
+  s_clock.local_offset_minutes = local_offset_minutes;
   
-  // October - DST starts on third Sunday
-  if (month == 10) {
-    // Find third Sunday of October (15th-21st)
-    int third_sunday = 15 + ((7 - wday + day) % 7);
-    if (third_sunday > 21) third_sunday -= 7;
-    return day >= third_sunday;
+  // Get the actual timezone index for the current display position
+  s_clock.actual_tz_index = get_active_timezone_index(current_timezone_index);
+  s_clock.valid_from = INT32_MIN;
+  s_clock.valid_until = INT32_MAX;
+  
+  if (s_clock.actual_tz_index == 0) {
+    s_clock.main_offset_minutes = local_offset_minutes;
+  } else {
+    // Get DST-adjusted offset for this timezone
+    s_clock.main_offset_minutes = get_slot_offset(s_clock.actual_tz_index, temp);
+    s_clock.valid_from = s_offset_cache[s_clock.actual_tz_index].valid_from;
+    s_clock.valid_until = s_offset_cache[s_clock.actual_tz_index].valid_until;
   }
   
-  // February - DST ends on third Sunday
-  if (month == 2) {
-    // Find third Sunday of February (15th-21st)
-    int third_sunday = 15 + ((7 - wday + day) % 7);
-    if (third_sunday > 21) third_sunday -= 7;
-    return day < third_sunday;
+  // Prepare timezone label with GMT offset
+  char label[sizeof(tz_label)];
+  put_zone_label(label, sizeof(label), s_clock.actual_tz_index, s_clock.main_offset_minutes);
+  set_text_if_changed(LINE_LABEL, label);
+  
+  // Handle home timezone display (always show when enabled and not already showing home)
+  s_clock.home_visible = always_show_home && is_slot_enabled(1) && s_clock.actual_tz_index != 1 &&
+                         s_power_tier < POWER_TIER_HOURLY;
+  if (s_clock.home_visible) {
+    // Get DST-adjusted offset for home timezone (slot 1 is always home)
+    s_clock.home_offset_minutes = get_slot_offset(1, temp);
+    if (s_offset_cache[1].valid_from > s_clock.valid_from) {
+      s_clock.valid_from = s_offset_cache[1].valid_from;
+    }
+    if (s_offset_cache[1].valid_until < s_clock.valid_until) {
+      s_clock.valid_until = s_offset_cache[1].valid_until;
+    }
+    // A frozen home line only changes with its offset, so it is drawn here, not per minute
+    if (s_power_tier >= POWER_TIER_FROZEN_HOME) {
+      char home_label[sizeof(home_time_buffer)];
+      put_zone_label(home_label, sizeof(home_label), 1, s_clock.home_offset_minutes);
+      show_time_line(LINE_HOME, home_label, -1);
+    }
+  }
+  set_line_visible(LINE_HOME, s_clock.home_visible);
+  if (!s_clock.home_visible) {
+    set_line_visible(LINE_HOME_SECONDS, false);
   }
   
-  return false;
+  s_clock.valid = true;
+  update_tick_subscription();
+}
+
+// Minutes of the day in a zone, derived from the local tick time
+static int zone_minutes_of_day(struct tm *local_tm, int offset_minutes) {
+  int minutes = local_tm->tm_hour * 60 + local_tm->tm_min - s_clock.local_offset_minutes + offset_minutes;
+  // Normalize
+  while (minutes < 0) minutes += 24 * 60;
+  return minutes % (24 * 60);
+}
+
+// Position of the seconds digits (after the last ':') in a formatted time string
+static int seconds_position(const char *buffer) {
+  const char *colon = strrchr(buffer, ':');
+  return colon ? (int)(colon - buffer) + 1 : -1;
+}
+
+// Whether seconds are shown right now. With seconds_window 0 that is whenever they are
+// enabled. Otherwise seconds are shown, and the CPU woken every second, only for
+// seconds_window seconds after a tap; then an app_timer drops the tick subscription
+// back to MINUTE_UNIT.
+static bool seconds_live(void) {
+  return (show_seconds || show_home_seconds) && (seconds_window == 0 || s_seconds_timer) &&
+         s_power_tier == POWER_TIER_FULL;
 }
 
-// Helper function to determine if DST is active for Chilean timezones
-static bool is_dst_active_cl(struct tm *tm) {
-  // DST in Chile: First Sunday in September to First Sunday in April (next year)
+// Minute work: rebuild hh:mm[:ss] for the main and home lines
+static void render_clock(struct tm *local_tm) {
+  int tz_minutes = zone_minutes_of_day(local_tm, s_clock.main_offset_minutes);
+  int display_hour = tz_minutes / 60;
+  int display_min = tz_minutes % 60;
+  bool is_24h = clock_is_24h_style();
+  bool live = seconds_live();
+  char text[sizeof(time_buffer)];
   
-  int month = tm->tm_mon + 1;  // tm_mon is 0-11, we need 1-12
-  int day = tm->tm_mday;
-  int wday = tm->tm_wday;  // 0=Sunday, 1=Monday, ..., 6=Saturday
+  s_clock.home_seconds_pos = -1;
   
-  // May to August - no DST
-  if (month >= 5 && month <= 8) {
-    return false;
+  // Hourly tier: the clock only ticks on the hour, so show no minutes to go stale
+  if (s_power_tier == POWER_TIER_HOURLY) {
+    *put_meridiem(put_hour(text, is_24h, display_hour), is_24h, display_hour) = '\0';
+    s_clock.main_seconds_pos = show_time_line(LINE_TIME, text, -1);
+    return;
   }
   
-  // October to March - always DST
-  if (month >= 10 || month <= 3) {
-    return true;
-  }
+  // Current timezone time
+  *put_clock(text, is_24h, display_hour, display_min, local_tm->tm_sec, show_seconds && live) = '\0';
+  s_clock.main_seconds_pos = show_time_line(LINE_TIME, text, show_seconds && live ? seconds_position(text) : -1);
   
-  // September - DST starts on first Sunday
-  if (month == 9) {
-    // Find first Sunday of September
-    int first_sunday = 1 + ((7 - wday + day) % 7);
-    if (first_sunday > 7) first_sunday -= 7;
-    return day >= first_sunday;
+  if (!s_clock.home_visible || s_power_tier >= POWER_TIER_FROZEN_HOME) {
+    return;
   }
   
-  // April - DST ends on first Sunday
-  if (month == 4) {
-    // Find first Sunday of April
-    int first_sunday = 1 + ((7 - wday + day) % 7);
-    if (first_sunday > 7) first_sunday -= 7;
-    return day < first_sunday;
-  }
+  int home_minutes = zone_minutes_of_day(local_tm, s_clock.home_offset_minutes);
+  int home_hour = home_minutes / 60;
+  int home_min = home_minutes % 60;
   
+  // Format home time without GMT offset (simplified)
+  char *end = put_text(text, get_slot_display_name(1, NULL), sizeof(text) - sizeof(": hh:mm:ss AM"));
+  *end++ = ':';
+  *end++ = ' ';
+  *put_clock(end, is_24h, home_hour, home_min, local_tm->tm_sec, show_home_seconds && live) = '\0';
+  s_clock.home_seconds_pos = show_time_line(LINE_HOME, text, show_home_seconds && live ? seconds_position(text) : -1);
+}
+
+// Second work: patch the two seconds digits of the seconds lines in place
+static void render_seconds(int sec) {
+  if (s_clock.main_seconds_pos >= 0) {
+    seconds_buffer[s_clock.main_seconds_pos] = '0' + sec / 10;
+    seconds_buffer[s_clock.main_seconds_pos + 1] = '0' + sec % 10;
+    mark_line_dirty(LINE_TIME_SECONDS);
+  }
+  if (s_clock.home_seconds_pos >= 0) {
+    home_seconds_buffer[s_clock.home_seconds_pos] = '0' + sec / 10;
+    home_seconds_buffer[s_clock.home_seconds_pos + 1] = '0' + sec % 10;
+    mark_line_dirty(LINE_HOME_SECONDS);
+  }
+}
+
+// Clock state machine: do only the work implied by units_changed
+static void clock_update(struct tm *local_tm, TimeUnits units_changed) {
+  if (!s_clock.valid || (units_changed & (HOUR_UNIT | DAY_UNIT | MONTH_UNIT | YEAR_UNIT))) {
+    refresh_zone_state(local_tm);
+    render_clock(local_tm);
+  } else if (units_changed & MINUTE_UNIT) {
+    // Offsets can change on a non-hour boundary of the watch's clock (e.g. a
+    // transition at 02:00 in a :30 zone), and the phone can change the watch's
+    // own timezone at any time, so check both here too
+    time_t now = time(NULL);
+    if (now < s_clock.valid_from || now >= s_clock.valid_until ||
+        get_local_offset_minutes(local_tm, now) != s_clock.local_offset_minutes) {
+      refresh_zone_state(local_tm);
+    }
+    render_clock(local_tm);
+  } else if (units_changed & SECOND_UNIT) {
+    render_seconds(local_tm->tm_sec);
+  }
+}
+
+// Full refresh, for config changes, timezone switches and window load
+static void update_time_display() {
+  time_t temp = time(NULL);
+  struct tm local_tm = *localtime(&temp);
+  s_clock.valid = false;
+  clock_update(&local_tm, SECOND_UNIT | MINUTE_UNIT | HOUR_UNIT | DAY_UNIT);
+}
+
+// Whether any configured zone's hours start off the watch's local hours (Asia/Kolkata on
+// a watch in a whole-hour zone), so local hour ticks would change its hour late once
+// it is shown
+static bool zone_hour_misaligned(void) {
+  if (!s_clock.valid) {
+    return false;
+  }
+  time_t utc = time(NULL);
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    if (get_slot_zone_id(slot) != 0 &&
+        (get_slot_offset(slot, utc) - s_clock.local_offset_minutes) % 60 != 0) {
+      return true;
+    }
+  }
   return false;
 }
 
-// Helper function to determine if DST is active for New Zealand
-static bool is_dst_active_nz(struct tm *tm) {
-  // DST in New Zealand: Last Sunday in September to First Sunday in April (next year)
-  
-  int month = tm->tm_mon + 1;  // tm_mon is 0-11, we need 1-12
-  int day = tm->tm_mday;
-  int wday = tm->tm_wday;  // 0=Sunday, 1=Monday, ..., 6=Saturday
-  
-  // May to August - no DST
-  if (month >= 5 && month <= 8) {
+// Tick service subscription: SECOND_UNIT while seconds are live, HOUR_UNIT in the
+// hourly power tier unless a configured zone's hour is misaligned, else MINUTE_UNIT
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed);
+
+static void update_tick_subscription(void) {
+  TimeUnits units = seconds_live() ? SECOND_UNIT :
+                    s_power_tier == POWER_TIER_HOURLY && !zone_hour_misaligned() ? HOUR_UNIT :
+                    MINUTE_UNIT;
+  if (units == s_tick_units) {
+    return;
+  }
+  tick_timer_service_unsubscribe();
+  tick_timer_service_subscribe(units, tick_handler);
+  s_tick_units = units;
+}
+
+static void seconds_window_expired(void *data) {
+  s_seconds_timer = NULL;
+  update_tick_subscription();
+  update_time_display();
+}
+
+// Opens the seconds window, or extends it if already open. Returns whether it opened,
+// in which case the caller redraws once it has made its own changes.
+static bool start_seconds_window(void) {
+  if (seconds_window == 0 || !(show_seconds || show_home_seconds) || s_power_tier != POWER_TIER_FULL) {
     return false;
   }
-  
-  // October to March - always DST
-  if (month >= 10 || month <= 3) {
-    return true;
+  if (s_seconds_timer) {
+    app_timer_reschedule(s_seconds_timer, seconds_window * 1000);
+    return false;
   }
-  
-  // September - DST starts on last Sunday
-  if (month == 9) {
-    // Find last Sunday of September (25th-30th)
-    int last_sunday = 30 - ((wday + 30 - day) % 7);
-    return day >= last_sunday;
+  s_seconds_timer = app_timer_register(seconds_window * 1000, seconds_window_expired, NULL);
+  update_tick_subscription();
+  return true;
+}
+
+// Whether the wearer is asleep or has Quiet Time on. Quiet Time has no event, so this is
+// polled from the tick handler once a minute; sleep changes also arrive as health events.
+static bool user_resting(void) {
+#ifdef PBL_API_EXISTS
+  if (PBL_API_EXISTS(quiet_time_is_active) && quiet_time_is_active()) {
+    return true;
   }
-  
-  // April - DST ends on first Sunday
-  if (month == 4) {
-    // Find first Sunday of April
-    int first_sunday = 1 + ((7 - wday + day) % 7);
-    if (first_sunday > 7) first_sunday -= 7;
-    return day < first_sunday;
+#endif
+#if defined(PBL_HEALTH)
+  if (health_service_peek_current_activities() & (HealthActivitySleep | HealthActivityRestfulSleep)) {
+    return true;
   }
-  
+#endif
   return false;
 }
 
-// Helper function to get DST-adjusted offset for a timezone
-static int get_dst_adjusted_offset(const char* timezone_id, int base_offset_minutes, struct tm *current_time) {
-  if (!timezone_id || !current_time) {
-    return base_offset_minutes;
-  }
-  
-  // US & Canadian Eastern Time zones
-  if (strcmp(timezone_id, "America/New_York") == 0 || 
-      strcmp(timezone_id, "America/Detroit") == 0 ||
-      strcmp(timezone_id, "America/Toronto") == 0 ||
-      strcmp(timezone_id, "America/Montreal") == 0 ||
-      strcmp(timezone_id, "America/Halifax") == 0 ||
-      strcmp(timezone_id, "Canada/Eastern") == 0 ||
-      strcmp(timezone_id, "Canada/Atlantic") == 0 ||
-      strcmp(timezone_id, "US/Eastern") == 0) {
-    if (is_dst_active_us(current_time)) {
-      return base_offset_minutes + 60;  // EDT: -4 hours instead of EST: -5 hours
+// The tier for the current battery and activity: the deepest one whose threshold the
+// charge is at or below, never less than POWER_TIER_FROZEN_HOME while resting, and
+// always POWER_TIER_FULL on the charger
+static PowerTier power_tier_for_state(void) {
+  if (s_battery.is_charging || s_battery.is_plugged) {
+    return POWER_TIER_FULL;
+  }
+  PowerTier tier = POWER_TIER_FULL;
+  for (int i = 0; i < 3; i++) {
+    if (power_thresholds[i] > 0 && s_battery.charge_percent <= power_thresholds[i]) {
+      tier = (PowerTier)(POWER_TIER_NO_SECONDS + i);
     }
-    return base_offset_minutes;  // EST: -5 hours
   }
-  
-  // US & Canadian Central Time zones
-  if (strcmp(timezone_id, "America/Chicago") == 0 ||
-      strcmp(timezone_id, "America/Winnipeg") == 0 ||
-      strcmp(timezone_id, "Canada/Central") == 0 ||
-      strcmp(timezone_id, "US/Central") == 0) {
-    if (is_dst_active_us(current_time)) {
-      return base_offset_minutes + 60;  // CDT: -5 hours instead of CST: -6 hours
-    }
-    return base_offset_minutes;  // CST: -6 hours
+  if (power_save_asleep && tier < POWER_TIER_FROZEN_HOME && user_resting()) {
+    tier = POWER_TIER_FROZEN_HOME;
   }
-  
-  // US & Canadian Mountain Time zones
-  if (strcmp(timezone_id, "America/Denver") == 0 ||
-      strcmp(timezone_id, "Canada/Mountain") == 0 ||
-      strcmp(timezone_id, "US/Mountain") == 0) {
-    if (is_dst_active_us(current_time)) {
-      return base_offset_minutes + 60;  // MDT: -6 hours instead of MST: -7 hours
-    }
-    return base_offset_minutes;  // MST: -7 hours
+  return tier;
+}
+
+// Re-evaluates the tier; on a change, resubscribes and redraws. Returns whether it changed.
+static bool update_power_tier(void) {
+  PowerTier tier = power_tier_for_state();
+  if (tier == s_power_tier) {
+    return false;
   }
-  
-  // US & Canadian Pacific Time zones
-  if (strcmp(timezone_id, "America/Los_Angeles") == 0 ||
-      strcmp(timezone_id, "America/Vancouver") == 0 ||
-      strcmp(timezone_id, "Canada/Pacific") == 0 ||
-      strcmp(timezone_id, "US/Pacific") == 0) {
-    if (is_dst_active_us(current_time)) {
-      return base_offset_minutes + 60;  // PDT: -7 hours instead of PST: -8 hours
-    }
-    return base_offset_minutes;  // PST: -8 hours
+  s_power_tier = tier;
+  update_tick_subscription();
+  update_time_display();
+  return true;
+}
+
+static void battery_handler(BatteryChargeState charge) {
+  s_battery = charge;
+  update_power_tier();
+}
+
+#if defined(PBL_HEALTH)
+static void health_handler(HealthEventType event, void *context) {
+  if (event == HealthEventSleepUpdate || event == HealthEventSignificantUpdate) {
+    update_power_tier();
   }
+}
+#endif
+
+// AppMessage key for a governor threshold (tiers 1-3, in message key order)
+static uint32_t power_threshold_key(int i) {
+  return MESSAGE_KEY_POWER_NO_SECONDS_BELOW + i;
+}
+
+static void switch_timezone() {
+  current_timezone_index = (current_timezone_index + 1) % active_timezone_count;
+  update_time_display();
+}
+
+// Accelerometer tap handler
+static void tap_handler(AccelAxisType axis, int32_t direction) {
+  // Single tap: turn on backlight, open the seconds window AND cycle timezone
+  light_enable_interaction();  
+  start_seconds_window();
+  // Cycle to next timezone; this redraws for the seconds window too
+  switch_timezone();
   
-  // Canadian Newfoundland Time (special case: UTC-3:30/-2:30)
-  if (strcmp(timezone_id, "Canada/Newfoundland") == 0) {
-    if (is_dst_active_us(current_time)) {
-      return base_offset_minutes + 60;  // NDT: -2:30 instead of NST: -3:30
-    }
-    return base_offset_minutes;  // NST: -3:30
-  }
-  
-  // Australian Eastern Time zones
-  if (strcmp(timezone_id, "Australia/Sydney") == 0 ||
-      strcmp(timezone_id, "Australia/Melbourne") == 0 ||
-      strcmp(timezone_id, "Australia/Canberra") == 0 ||
-      strcmp(timezone_id, "Australia/ACT") == 0 ||
-      strcmp(timezone_id, "Australia/Tasmania") == 0 ||
-      strcmp(timezone_id, "Australia/Hobart") == 0) {
-    if (is_dst_active_au(current_time)) {
-      return base_offset_minutes + 60;  // AEDT: +11 hours instead of AEST: +10 hours
-    }
-    return base_offset_minutes;  // AEST: +10 hours
+  // APP_LOG(APP_LOG_LEVEL_INFO, "Tap detected: Backlight on + cycling to next timezone");
+}
+
+// Time tick handler
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+  // The tier is polled once a minute, not on every seconds tick; a change has already
+  // redrawn everything
+  if ((units_changed & MINUTE_UNIT) && update_power_tier()) {
+    return;
   }
-  
-  // Australian Central Time zones
-  if (strcmp(timezone_id, "Australia/Adelaide") == 0 ||
-      strcmp(timezone_id, "Australia/Broken_Hill") == 0) {
-    if (is_dst_active_au(current_time)) {
-      return base_offset_minutes + 60;  // ACDT: +10:30 instead of ACST: +9:30
+  clock_update(tick_time, units_changed);
+}
+
+// Packed configuration: one byte array under MESSAGE_KEY_CONFIG, built by
+// encodeSections() and sendConfig() in index.js. A version byte, a mask of the sections present and two revisions come
+// first, then each present section in CONFIG_SECTION_* order. uint16 fields are
+// little-endian and colors are 0xRRGGBB in three bytes, most significant first.
+//
+// The phone sends only the sections that changed since the last blob the watch
+// acknowledged. Such a delta names that blob's revision as its base and only applies
+// on top of it; a full blob (base 0, every section) always applies. A blob the watch
+// cannot apply is answered with its current revision, and the phone resyncs in full.
+#define CONFIG_BLOB_VERSION 2
+#define CONFIG_HEADER_SIZE 6         // Version, sections, uint16 base revision, uint16 revision
+#define CONFIG_SECTION_ZONES 0x01    // 5 x uint16 zone id (Home, Timezones 1-4), 0 = none
+#define CONFIG_SECTION_DISPLAY 0x02  // CONFIG_FLAG_* byte, seconds window in seconds
+#define CONFIG_SECTION_COLORS 0x04   // Background, time, label and home time colors
+#define CONFIG_SECTION_POWER 0x08    // 3 battery thresholds in %, CONFIG_FLAG_SAVE_ASLEEP byte
+#define CONFIG_SECTION_COUNT 4
+#define CONFIG_SECTIONS_ALL 0x0F
+#define CONFIG_FLAG_ALWAYS_SHOW_HOME 0x01
+#define CONFIG_FLAG_SHOW_SECONDS 0x02
+#define CONFIG_FLAG_SHOW_HOME_SECONDS 0x04
+#define CONFIG_FLAG_SAVE_ASLEEP 0x01
+
+static const uint8_t s_config_section_sizes[CONFIG_SECTION_COUNT] = {10, 2, 12, 4};
+static uint16_t s_config_revision;  // Of the last applied blob, 0 = none
+
+// A blob is usable when its version matches and its length is exactly what its
+// section mask announces
+static bool config_blob_valid(const uint8_t *data, uint16_t length) {
+  if (length < CONFIG_HEADER_SIZE || data[0] != CONFIG_BLOB_VERSION) {
+    return false;
+  }
+  uint16_t expected = CONFIG_HEADER_SIZE;
+  for (int i = 0; i < CONFIG_SECTION_COUNT; i++) {
+    if (data[1] & (1 << i)) {
+      expected += s_config_section_sizes[i];
     }
-    return base_offset_minutes;  // ACST: +9:30
   }
-  
-  // Australian Western Time (no DST since 2009)
-  if (strcmp(timezone_id, "Australia/Perth") == 0 ||
-      strcmp(timezone_id, "Australia/West") == 0) {
-    return base_offset_minutes;  // AWST: +8 hours (no DST)
+  return length == expected;
+}
+
+// A full blob applies to any state, a delta only to the revision it was built against
+static bool config_blob_applies(const uint8_t *data) {
+  uint16_t base = read_u16(data + 2);
+  return base == 0 ? data[1] == CONFIG_SECTIONS_ALL : base == s_config_revision;
+}
+
+// Tells the phone which revision the watch holds, after a blob it could not apply
+static void report_config_revision(void) {
+  DictionaryIterator *iterator;
+  if (app_message_outbox_begin(&iterator) != APP_MSG_OK) {
+    return;
+  }
+  dict_write_uint16(iterator, MESSAGE_KEY_CONFIG_REVISION, s_config_revision);
+  app_message_outbox_send();
+}
+
+static uint32_t read_color(const uint8_t *data) {
+  return ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | data[2];
+}
+
+// Applies the sections present in a valid blob in one pass; the caller persists them
+static void apply_config_blob(const uint8_t *data) {
+  uint8_t sections = data[1];
+  const uint8_t *field = data + CONFIG_HEADER_SIZE;
+  
+  if (sections & CONFIG_SECTION_ZONES) {
+    // Slot 1 = Home, slots 2-5 = Timezones 1-4
+    for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+      load_timezone_config_id(slot, read_u16(field));
+      field += 2;
+    }
   }
   
-  // Brazilian timezones (DST suspended since 2019, but keeping for historical accuracy)
-  if (strcmp(timezone_id, "America/Sao_Paulo") == 0 ||
-      strcmp(timezone_id, "Brazil/East") == 0) {
-    // Note: Brazil suspended DST in 2019, so always return standard time
-    return base_offset_minutes;  // BRT: -3 hours (no DST since 2019)
+  if (sections & CONFIG_SECTION_DISPLAY) {
+    always_show_home = field[0] & CONFIG_FLAG_ALWAYS_SHOW_HOME;
+    show_seconds = field[0] & CONFIG_FLAG_SHOW_SECONDS;
+    show_home_seconds = field[0] & CONFIG_FLAG_SHOW_HOME_SECONDS;
+    seconds_window = field[1];
+    field += 2;
   }
   
-  // Chilean timezone
-  if (strcmp(timezone_id, "America/Santiago") == 0 ||
-      strcmp(timezone_id, "Chile/Continental") == 0) {
-    if (is_dst_active_cl(current_time)) {
-      return base_offset_minutes + 60;  // CLST: -3 hours instead of CLT: -4 hours
+  if (sections & CONFIG_SECTION_COLORS) {
+    for (int i = 0; i < 4; i++) {
+      s_settings.colors[i] = read_color(field + 3 * i);
     }
-    return base_offset_minutes;  // CLT: -4 hours
+    apply_setting_colors();
+    window_set_background_color(s_window, background_color);
+    set_line_color(LINE_TIME, time_color);
+    set_line_color(LINE_LABEL, timezone_label_color);
+    set_line_color(LINE_HOME, home_time_color);
+    field += 12;
   }
   
-  // New Zealand timezone
-  if (strcmp(timezone_id, "Pacific/Auckland") == 0 ||
-      strcmp(timezone_id, "NZ") == 0) {
-    if (is_dst_active_nz(current_time)) {
-      return base_offset_minutes + 60;  // NZDT: +13 hours instead of NZST: +12 hours
+  if (sections & CONFIG_SECTION_POWER) {
+    for (int i = 0; i < 3; i++) {
+      power_thresholds[i] = field[i];
     }
-    return base_offset_minutes;  // NZST: +12 hours
+    power_save_asleep = field[3] & CONFIG_FLAG_SAVE_ASLEEP;
   }
   
-  // European Time zones
-  if (strncmp(timezone_id, "Europe/", 7) == 0) {
-    // Russian timezones don't observe DST (abolished in 2014)
-    if (strncmp(timezone_id, "Europe/Moscow", 13) == 0 ||
-        strncmp(timezone_id, "Europe/Kaliningrad", 18) == 0 ||
-        strncmp(timezone_id, "Europe/Volgograd", 16) == 0 ||
-        strncmp(timezone_id, "Europe/Samara", 13) == 0) {
-      return base_offset_minutes;  // Russian zones use permanent standard time
-    }
-    
-    // Belarus doesn't observe DST (abolished in 2018)
-    if (strncmp(timezone_id, "Europe/Minsk", 12) == 0) {
-      return base_offset_minutes;  // Belarus uses permanent standard time
-    }
-    
-    // Iceland doesn't observe DST
-    if (strncmp(timezone_id, "Europe/Reykjavik", 16) == 0) {
-      return base_offset_minutes;  // Iceland uses permanent GMT
-    }
-    
-    // Most other European countries follow EU DST rules
-    if (is_dst_active_eu(current_time)) {
-      return base_offset_minutes + 60;  // Summer time: +1 hour
+  s_config_revision = read_u16(data + 4);
+}
+
+// CRC-32 (IEEE 802.3), bitwise: the record is too small to be worth a table
+static uint32_t crc32(const uint8_t *data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  while (length--) {
+    crc ^= *data++;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
     }
-    return base_offset_minutes;  // Standard time
   }
-  
-  // For other timezones, return base offset (no DST handling implemented yet)
-  return base_offset_minutes;
+  return ~crc;
 }
 
-// Helper function to convert hex color to GColor
-static GColor hex_to_gcolor(uint32_t hex) {
-#ifdef PBL_COLOR
-  return GColorFromHEX(hex);
-#else
-  // For black and white platforms, map to appropriate grayscale
-  uint8_t r = (hex >> 16) & 0xFF;
-  uint8_t g = (hex >> 8) & 0xFF;
-  uint8_t b = hex & 0xFF;
-  uint8_t gray = (r + g + b) / 3;
-  return gray > 128 ? GColorWhite : GColorBlack;
-#endif
+// Writes the current configuration as one Settings record
+static void save_settings(void) {
+  s_settings.version = SETTINGS_VERSION;
+  s_settings.flags = (always_show_home ? SETTINGS_FLAG_ALWAYS_SHOW_HOME : 0) |
+                     (show_seconds ? SETTINGS_FLAG_SHOW_SECONDS : 0) |
+                     (show_home_seconds ? SETTINGS_FLAG_SHOW_HOME_SECONDS : 0) |
+                     (power_save_asleep ? SETTINGS_FLAG_SAVE_ASLEEP : 0);
+  s_settings.seconds_window = seconds_window;
+  for (int i = 0; i < 3; i++) {
+    s_settings.power_thresholds[i] = power_thresholds[i];
+  }
+  s_settings.config_revision = s_config_revision;
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    s_settings.zone_ids[slot - 1] = get_slot_zone_id(slot);
+  }
+  s_settings.crc = crc32((const uint8_t *)&s_settings, sizeof(s_settings) - sizeof(s_settings.crc));
+  persist_write_data(PERSIST_KEY_SETTINGS, &s_settings, sizeof(s_settings));
 }
 
-// Initialize default colors
-static void init_default_colors() {
-  background_color = GColorBlack;
-  time_color = GColorWhite;
-#ifdef PBL_COLOR
-  timezone_label_color = GColorLightGray;
-  home_time_color = GColorLightGray;
-#else
-  timezone_label_color = GColorWhite;
-  home_time_color = GColorWhite;
-#endif
+// Restores the configuration from the Settings record; false if there is no valid one
+static bool load_settings(void) {
+  Settings settings;
+  if (persist_read_data(PERSIST_KEY_SETTINGS, &settings, sizeof(settings)) != (int)sizeof(settings) ||
+      settings.version != SETTINGS_VERSION ||
+      settings.crc != crc32((const uint8_t *)&settings, sizeof(settings) - sizeof(settings.crc))) {
+    return false;
+  }
+  s_settings = settings;
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    load_timezone_config_id(slot, settings.zone_ids[slot - 1]);
+  }
+  always_show_home = settings.flags & SETTINGS_FLAG_ALWAYS_SHOW_HOME;
+  show_seconds = settings.flags & SETTINGS_FLAG_SHOW_SECONDS;
+  show_home_seconds = settings.flags & SETTINGS_FLAG_SHOW_HOME_SECONDS;
+  power_save_asleep = settings.flags & SETTINGS_FLAG_SAVE_ASLEEP;
+  seconds_window = settings.seconds_window;
+  for (int i = 0; i < 3; i++) {
+    power_thresholds[i] = settings.power_thresholds[i];
+  }
+  s_config_revision = settings.config_revision;
+  apply_setting_colors();
+  return true;
 }
 
-// Configuration functions
-static void load_timezone_config(int slot, const char* timezone_id) {
-  // APP_LOG(APP_LOG_LEVEL_INFO, "load_timezone_config: slot=%d, timezone_id='%s'", slot, timezone_id);
-  
-  if (slot < 1 || slot >= MAX_TIMEZONES) {
-    // APP_LOG(APP_LOG_LEVEL_WARNING, "Invalid slot %d, ignoring", slot);
-    return;  // Don't modify Local (slot 0)
+// A schedule is usable when its version matches, its zones fit the slots and their
+// changes are ordered, inside the span, and exactly fill length
+static bool schedule_valid(const uint8_t *data, uint16_t length) {
+  if (length < SCHEDULE_HEADER_SIZE || length > SCHEDULE_MAX_SIZE || data[0] != SCHEDULE_VERSION ||
+      data[1] > MAX_TIMEZONES - 1) {
+    return false;
   }
-  
-  if (strlen(timezone_id) == 0) {
-    // Disable this timezone slot
-    timezones[slot].enabled = false;
-    strcpy(timezones[slot].name, "");
-    if (slot == 1) {
-      strcpy(timezones[slot].display_name, "Home");  // Keep "Home" label for slot 1
-    } else {
-      strcpy(timezones[slot].display_name, "");
+  uint16_t span = read_u16(data + 6);
+  uint16_t position = SCHEDULE_HEADER_SIZE;
+  for (int zone = 0; zone < data[1]; zone++) {
+    if (position + SCHEDULE_ZONE_HEADER_SIZE > length || data[position + 3] > SCHEDULE_MAX_CHANGES) {
+      return false;
     }
-  timezones[slot].offset_minutes = 0;
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Disabled timezone slot %d", slot);
-  } else {
-    // Find the timezone configuration in the shared array
-    for (int i = 0; i < num_timezone_configs; i++) {
-      if (strcmp(SHARED_TIMEZONES[i].identifier, timezone_id) == 0) {
-        timezones[slot].enabled = true;
-        strncpy(timezones[slot].name, SHARED_TIMEZONES[i].identifier, sizeof(timezones[slot].name));
-        timezones[slot].name[sizeof(timezones[slot].name)-1] = '\0';
-        if (slot == 1) {
-          strncpy(timezones[slot].display_name, "Home", sizeof(timezones[slot].display_name));  // Always show "Home" for slot 1
-        } else {
-          strncpy(timezones[slot].display_name, SHARED_TIMEZONES[i].display_name, sizeof(timezones[slot].display_name));
-        }
-        timezones[slot].display_name[sizeof(timezones[slot].display_name)-1] = '\0';
-        timezones[slot].offset_minutes = SHARED_TIMEZONES[i].offset_minutes;
-        //APP_LOG(APP_LOG_LEVEL_INFO, "Configured slot %d: %s (%s), offset_minutes=%d", 
-        // slot, timezones[slot].display_name, timezones[slot].name, timezones[slot].offset_minutes);
-        break;
+    int count = data[position + 3];
+    position += SCHEDULE_ZONE_HEADER_SIZE;
+    if (position + count * SCHEDULE_CHANGE_SIZE > length) {
+      return false;
+    }
+    uint16_t previous = 0;
+    for (int i = 0; i < count; i++, position += SCHEDULE_CHANGE_SIZE) {
+      uint16_t quarter = read_u16(data + position);
+      if (quarter >= span || (i > 0 && quarter <= previous)) {
+        return false;
       }
+      previous = quarter;
     }
   }
+  return position == length;
 }
 
-static void update_active_timezone_count() {
-  active_timezone_count = 0;
-  for (int i = 0; i < MAX_TIMEZONES; i++) {
-    if (timezones[i].enabled) {
-      active_timezone_count++;
-    }
-  }
-  
-  // Ensure current index is valid
-  if (current_timezone_index >= active_timezone_count) {
-    current_timezone_index = 0;
+// Takes a valid schedule into s_schedule and points the slots at their zones in it
+static void use_schedule(const uint8_t *data, uint16_t length) {
+  memcpy(s_schedule, data, length);
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    s_schedule_zone[slot] = is_slot_enabled(slot) ? find_schedule_zone(get_slot_zone_id(slot)) : 0;
+    s_offset_cache[slot].valid_from = 0;
+    s_offset_cache[slot].valid_until = 0;
   }
 }
 
-static int get_active_timezone_index(int display_index) {
-  int count = 0;
-  for (int i = 0; i < MAX_TIMEZONES; i++) {
-    if (timezones[i].enabled) {
-      if (count == display_index) {
-        return i;
-      }
-      count++;
-    }
+// Restores the persisted schedule, if there is a valid one
+static void load_schedule(void) {
+  uint8_t data[SCHEDULE_MAX_SIZE];
+  int length = persist_read_data(PERSIST_KEY_SCHEDULE, data, sizeof(data));
+  if (length > 0 && schedule_valid(data, length)) {
+    use_schedule(data, length);
   }
-  return 0;  // Fallback to first timezone
 }
 
-static void update_time_display() {
-  // Get current time and UTC
-  time_t temp = time(NULL);
-  struct tm *local_tm = localtime(&temp);
-  struct tm *utc_tm = gmtime(&temp);
+// A schedule from the phone replaces the current one and is persisted as received
+static void receive_schedule(const uint8_t *data, uint16_t length) {
+  if (!schedule_valid(data, length)) {
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Ignoring invalid offset schedule (%d bytes)", length);
+    return;
+  }
+  use_schedule(data, length);
+  persist_write_data(PERSIST_KEY_SCHEDULE, data, length);
+  update_time_display();
+}
 
-  // Get the actual timezone index for the current display position
-  int actual_tz_index = get_active_timezone_index(current_timezone_index);
-  Timezone current_tz = timezones[actual_tz_index];
-
-  // Calculate minutes-since-midnight for current timezone
-  int display_hour = 0;
-  int display_min = 0;
-  if (actual_tz_index == 0) {
-    // Local time: use localtm directly
-    display_hour = local_tm->tm_hour;
-    display_min = local_tm->tm_min;
-  } else {
-    int utc_minutes = utc_tm->tm_hour * 60 + utc_tm->tm_min;
-    // Get DST-adjusted offset for this timezone
-    int adjusted_offset = get_dst_adjusted_offset(current_tz.name, current_tz.offset_minutes, local_tm);
-    int tz_minutes = utc_minutes + adjusted_offset;
-    // Normalize
-    while (tz_minutes < 0) tz_minutes += 24 * 60;
-    tz_minutes %= 24 * 60;
-    display_hour = tz_minutes / 60;
-    display_min = tz_minutes % 60;
-  }
-  
-  // Format time string for current timezone
-  static char time_buffer[32];
-  static char home_time_buffer[32];
-  
-  // Current timezone time
-  if (clock_is_24h_style()) {
-    if (show_seconds) {
-      snprintf(time_buffer, sizeof(time_buffer), "%02d:%02d:%02d", display_hour, display_min, local_tm->tm_sec);
-    } else {
-      snprintf(time_buffer, sizeof(time_buffer), "%02d:%02d", display_hour, display_min);
-    }
-  } else {
-    int disp = display_hour;
-    if (disp == 0) disp = 12;
-    if (disp > 12) disp -= 12;
-    if (show_seconds) {
-      snprintf(time_buffer, sizeof(time_buffer), "%d:%02d:%02d %s", disp, display_min, local_tm->tm_sec, (display_hour >= 12) ? "PM" : "AM");
-    } else {
-      snprintf(time_buffer, sizeof(time_buffer), "%d:%02d %s", disp, display_min, (display_hour >= 12) ? "PM" : "AM");
-    }
-  }
-  
-  // Update main display - always show the current timezone name and time
-  // Prepare timezone label with GMT offset
-  static char tz_label[64];  // Increased size to accommodate timezone name + GMT offset
-  
-  if (strcmp(current_tz.display_name, "Local") == 0) {
-    // For local timezone, calculate the actual GMT offset
-    time_t temp_time = time(NULL);
-    struct tm *local_tm = localtime(&temp_time);
-    struct tm *utc_tm = gmtime(&temp_time);
-    
-    // Calculate offset in minutes
-    int local_offset_minutes = (local_tm->tm_hour - utc_tm->tm_hour) * 60 + (local_tm->tm_min - utc_tm->tm_min);
-    
-    // Handle day boundary crossings
-    if (local_offset_minutes > 12 * 60) {
-      local_offset_minutes -= 24 * 60;
-    } else if (local_offset_minutes < -12 * 60) {
-      local_offset_minutes += 24 * 60;
-    }
-    
-    // Format GMT offset
-    int offset_hours = local_offset_minutes / 60;
-    int offset_mins = abs(local_offset_minutes % 60);
-    
-    if (local_offset_minutes >= 0) {
-      snprintf(tz_label, sizeof(tz_label), "local (GMT +%02d:%02d)", offset_hours, offset_mins);
-    } else {
-      snprintf(tz_label, sizeof(tz_label), "local (GMT -%02d:%02d)", abs(offset_hours), offset_mins);
-    }
-  } else {
-    // For configured timezones, calculate DST-adjusted offset and display it
-    int adjusted_offset = get_dst_adjusted_offset(current_tz.name, current_tz.offset_minutes, local_tm);
-    int offset_hours = adjusted_offset / 60;
-    int offset_mins = abs(adjusted_offset % 60);
-    
-    if (adjusted_offset >= 0) {
-      snprintf(tz_label, sizeof(tz_label), "%s (GMT +%02d:%02d)", current_tz.display_name, offset_hours, offset_mins);
-    } else {
-      snprintf(tz_label, sizeof(tz_label), "%s (GMT -%02d:%02d)", current_tz.display_name, abs(offset_hours), offset_mins);
-    }
+// An overlay is usable when its version matches, its length fits its record count and
+// every record is in order, within range and names a compiled rule
+static bool overlay_valid(const uint8_t *data, uint16_t length) {
+  if (length < OVERLAY_HEADER_SIZE || data[0] != OVERLAY_VERSION || data[1] > OVERLAY_MAX_RECORDS ||
+      length != OVERLAY_HEADER_SIZE + data[1] * OVERLAY_RECORD_SIZE) {
+    return false;
   }
-  
-  text_layer_set_text(s_timezone_layer, tz_label);
-  text_layer_set_text(s_time_layer, time_buffer);
-
-  // Handle home timezone display (always show when enabled and not already showing home)
-  if (always_show_home && timezones[1].enabled && actual_tz_index != 1) {
-    // Calculate home timezone time (slot 1 is always home)
-    if (timezones[1].enabled) {
-      int utc_minutes = utc_tm->tm_hour * 60 + utc_tm->tm_min;
-      // Get DST-adjusted offset for home timezone
-      int home_adjusted_offset = get_dst_adjusted_offset(timezones[1].name, timezones[1].offset_minutes, local_tm);
-      int home_minutes = utc_minutes + home_adjusted_offset;
-      while (home_minutes < 0) home_minutes += 24 * 60;
-      home_minutes %= 24 * 60;
-      int home_hour = home_minutes / 60;
-      int home_min = home_minutes % 60;
-      
-      // Format home time without GMT offset (simplified)
-      if (clock_is_24h_style()) {
-        if (show_home_seconds) {
-          snprintf(home_time_buffer, sizeof(home_time_buffer), "%s: %02d:%02d:%02d", 
-                  timezones[1].display_name, home_hour, home_min, local_tm->tm_sec);
-        } else {
-          snprintf(home_time_buffer, sizeof(home_time_buffer), "%s: %02d:%02d", 
-                  timezones[1].display_name, home_hour, home_min);
-        }
-      } else {
-        int home_display_hour = home_hour;
-        if (home_display_hour == 0) home_display_hour = 12;
-        if (home_display_hour > 12) home_display_hour -= 12;
-        if (show_home_seconds) {
-          snprintf(home_time_buffer, sizeof(home_time_buffer), "%s: %d:%02d:%02d %s", 
-                  timezones[1].display_name, home_display_hour, home_min, local_tm->tm_sec, (home_hour >= 12) ? "PM" : "AM");
-        } else {
-          snprintf(home_time_buffer, sizeof(home_time_buffer), "%s: %d:%02d %s", 
-                  timezones[1].display_name, home_display_hour, home_min, (home_hour >= 12) ? "PM" : "AM");
-        }
-      }
-      text_layer_set_text(s_home_time_layer, home_time_buffer);
-      layer_set_hidden(text_layer_get_layer(s_home_time_layer), false);
-      // APP_LOG(APP_LOG_LEVEL_INFO, "Showing home timezone: %s", home_time_buffer);
+  for (int i = 0; i < data[1]; i++) {
+    const uint8_t *record = data + OVERLAY_HEADER_SIZE + i * OVERLAY_RECORD_SIZE;
+    int16_t offset_minutes = (int16_t)read_u16(record + 2);
+    if ((i > 0 && read_u16(record) <= read_u16(record - OVERLAY_RECORD_SIZE)) ||
+        offset_minutes < -OVERLAY_MAX_OFFSET || offset_minutes > OVERLAY_MAX_OFFSET ||
+        record[4] >= TZ_RULE_COUNT) {
+      return false;
     }
-    
-    text_layer_set_text(s_home_time_layer, home_time_buffer);
-    layer_set_hidden(text_layer_get_layer(s_home_time_layer), false);
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Showing home timezone: %s", home_time_buffer);
-  } else {
-    // Hide home timezone display
-    layer_set_hidden(text_layer_get_layer(s_home_time_layer), true);
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Hiding home timezone display");
   }
+  return true;
 }
 
-static void switch_timezone() {
-  current_timezone_index = (current_timezone_index + 1) % active_timezone_count;
-  update_time_display();
+// Takes a valid overlay into s_overlay and drops every slot's cached offset, so the
+// next lookup picks up its zone's record or drops the one it had
+static void use_overlay(const uint8_t *data, uint16_t length) {
+  memcpy(s_overlay, data, length);
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    s_offset_cache[slot].valid_from = 0;
+    s_offset_cache[slot].valid_until = 0;
+  }
 }
 
-// Accelerometer tap handler
-static void tap_handler(AccelAxisType axis, int32_t direction) {
-  // Single tap: turn on backlight AND cycle timezone
-  light_enable_interaction();  
-  // Cycle to next timezone
-  switch_timezone();
-  
-  // APP_LOG(APP_LOG_LEVEL_INFO, "Tap detected: Backlight on + cycling to next timezone");
+// Restores the persisted overlay, if there is a valid one
+static void load_overlay(void) {
+  uint8_t data[OVERLAY_MAX_SIZE];
+  int length = persist_read_data(PERSIST_KEY_OVERLAY, data, sizeof(data));
+  if (length > 0 && overlay_valid(data, length)) {
+    use_overlay(data, length);
+  }
 }
 
-// Time tick handler
-static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+// An overlay from the phone replaces the current one and is persisted as received
+static void receive_overlay(const uint8_t *data, uint16_t length) {
+  if (!overlay_valid(data, length)) {
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Ignoring invalid zone overlay (%d bytes)", length);
+    return;
+  }
+  use_overlay(data, length);
+  persist_write_data(PERSIST_KEY_OVERLAY, data, length);
   update_time_display();
 }
 
@@ -680,111 +1530,46 @@ static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
 static void inbox_received_callback(DictionaryIterator *iterator, void *context) {
   // APP_LOG(APP_LOG_LEVEL_INFO, "Configuration message received");
   
-  // Read configuration from phone
-  Tuple *home_tuple = dict_find(iterator, MESSAGE_KEY_HOME);
-  Tuple *timezone_1_tuple = dict_find(iterator, MESSAGE_KEY_TIMEZONE_1);
-  Tuple *timezone_2_tuple = dict_find(iterator, MESSAGE_KEY_TIMEZONE_2);
-  Tuple *timezone_3_tuple = dict_find(iterator, MESSAGE_KEY_TIMEZONE_3);
-  Tuple *timezone_4_tuple = dict_find(iterator, MESSAGE_KEY_TIMEZONE_4);
-  Tuple *always_show_home_tuple = dict_find(iterator, MESSAGE_KEY_ALWAYS_SHOW_HOME);
-  Tuple *background_color_tuple = dict_find(iterator, MESSAGE_KEY_BACKGROUND_COLOR);
-  Tuple *time_color_tuple = dict_find(iterator, MESSAGE_KEY_TIME_COLOR);
-  Tuple *timezone_label_color_tuple = dict_find(iterator, MESSAGE_KEY_TIMEZONE_LABEL_COLOR);
-  Tuple *home_time_color_tuple = dict_find(iterator, MESSAGE_KEY_HOME_TIME_COLOR);
-  Tuple *show_seconds_tuple = dict_find(iterator, MESSAGE_KEY_SHOW_SECONDS);
-  Tuple *show_home_seconds_tuple = dict_find(iterator, MESSAGE_KEY_SHOW_HOME_SECONDS);
-  
-  if (home_tuple) {
-    load_timezone_config(1, home_tuple->value->cstring);  // Slot 1 = Home
-    persist_write_string(MESSAGE_KEY_HOME, home_tuple->value->cstring);
-  }
-  
-  if (timezone_1_tuple) {
-    load_timezone_config(2, timezone_1_tuple->value->cstring);  // Slot 2 = Timezone 3
-    persist_write_string(MESSAGE_KEY_TIMEZONE_1, timezone_1_tuple->value->cstring);
-  }
-  
-  if (timezone_2_tuple) {
-    load_timezone_config(3, timezone_2_tuple->value->cstring);  // Slot 3 = Timezone 4
-    persist_write_string(MESSAGE_KEY_TIMEZONE_2, timezone_2_tuple->value->cstring);
-  }
-  
-  if (timezone_3_tuple) {
-    load_timezone_config(4, timezone_3_tuple->value->cstring);  // Slot 4 = Timezone 5
-    persist_write_string(MESSAGE_KEY_TIMEZONE_3, timezone_3_tuple->value->cstring);
-  }
-  
-  if (timezone_4_tuple) {
-    load_timezone_config(5, timezone_4_tuple->value->cstring);  // Slot 5 = Timezone 6
-    persist_write_string(MESSAGE_KEY_TIMEZONE_4, timezone_4_tuple->value->cstring);
+  Tuple *overlay_tuple = dict_find(iterator, MESSAGE_KEY_OVERLAY);
+  if (overlay_tuple && overlay_tuple->type == TUPLE_BYTE_ARRAY) {
+    receive_overlay(overlay_tuple->value->data, overlay_tuple->length);
   }
   
-  if (always_show_home_tuple) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "ALWAYS_SHOW_HOME tuple found, value: %d", (int)always_show_home_tuple->value->int32);
-    always_show_home = (always_show_home_tuple->value->int32 == 1);
-    persist_write_bool(MESSAGE_KEY_ALWAYS_SHOW_HOME, always_show_home);
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Always show home timezone: %s", always_show_home ? "true" : "false");
-  } else {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "ALWAYS_SHOW_HOME tuple not found in message");
+  Tuple *schedule_tuple = dict_find(iterator, MESSAGE_KEY_SCHEDULE);
+  if (schedule_tuple && schedule_tuple->type == TUPLE_BYTE_ARRAY) {
+    receive_schedule(schedule_tuple->value->data, schedule_tuple->length);
   }
   
-  // Handle color settings
-  if (background_color_tuple) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Setting BACKGROUND_COLOR: %d", (int)background_color_tuple->value->int32);
-    background_color = hex_to_gcolor(background_color_tuple->value->int32);
-    persist_write_int(MESSAGE_KEY_BACKGROUND_COLOR, background_color_tuple->value->int32);
-    window_set_background_color(s_window, background_color);
+  Tuple *config_tuple = dict_find(iterator, MESSAGE_KEY_CONFIG);
+  if (!config_tuple || config_tuple->type != TUPLE_BYTE_ARRAY) {
+    return;
   }
-  
-  if (time_color_tuple) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Setting TIME_COLOR: %d for s_time_layer", (int)time_color_tuple->value->int32);
-    time_color = hex_to_gcolor(time_color_tuple->value->int32);
-    persist_write_int(MESSAGE_KEY_TIME_COLOR, time_color_tuple->value->int32);
-    text_layer_set_text_color(s_time_layer, time_color);
+  const uint8_t *data = config_tuple->value->data;
+  if (!config_blob_valid(data, config_tuple->length) || !config_blob_applies(data)) {
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Config blob does not apply to revision %d", s_config_revision);
+    report_config_revision();
+    return;
   }
-  
-  if (timezone_label_color_tuple) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Setting TIMEZONE_LABEL_COLOR: %d for s_timezone_layer", (int)timezone_label_color_tuple->value->int32);
-    timezone_label_color = hex_to_gcolor(timezone_label_color_tuple->value->int32);
-    persist_write_int(MESSAGE_KEY_TIMEZONE_LABEL_COLOR, timezone_label_color_tuple->value->int32);
-    text_layer_set_text_color(s_timezone_layer, timezone_label_color);
+  // A header with no sections only checks that the watch holds its base revision
+  if (!data[1]) {
+    return;
   }
+  apply_config_blob(data);
+  save_settings();
   
-  if (home_time_color_tuple) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Setting HOME_TIME_COLOR: %d for s_home_time_layer", (int)home_time_color_tuple->value->int32);
-    home_time_color = hex_to_gcolor(home_time_color_tuple->value->int32);
-    persist_write_int(MESSAGE_KEY_HOME_TIME_COLOR, home_time_color_tuple->value->int32);
-    text_layer_set_text_color(s_home_time_layer, home_time_color);
+  // Redo only what the touched sections feed; colors were pushed as they were applied
+  uint8_t sections = data[1];
+  if (sections & (CONFIG_SECTION_DISPLAY | CONFIG_SECTION_POWER)) {
+    s_power_tier = power_tier_for_state();
+    update_tick_subscription();
   }
-  
-  // Handle display options
-  if (show_seconds_tuple) {
-    show_seconds = (show_seconds_tuple->value->int32 == 1);
-    persist_write_bool(MESSAGE_KEY_SHOW_SECONDS, show_seconds);
-    // Update tick timer subscription based on seconds display
-    tick_timer_service_unsubscribe();
-    if (show_seconds || show_home_seconds) {
-      tick_timer_service_subscribe(SECOND_UNIT, tick_handler);
-    } else {
-      tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
-    }
+  if (sections & CONFIG_SECTION_ZONES) {
+    update_active_timezone_count();
   }
-  
-  if (show_home_seconds_tuple) {
-    show_home_seconds = (show_home_seconds_tuple->value->int32 == 1);
-    persist_write_bool(MESSAGE_KEY_SHOW_HOME_SECONDS, show_home_seconds);
-    // Update tick timer subscription based on seconds display
-    tick_timer_service_unsubscribe();
-    if (show_seconds || show_home_seconds) {
-      tick_timer_service_subscribe(SECOND_UNIT, tick_handler);
-    } else {
-      tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
-    }
+  if (sections & (CONFIG_SECTION_ZONES | CONFIG_SECTION_DISPLAY | CONFIG_SECTION_POWER)) {
+    update_time_display();
   }
   
-  update_active_timezone_count();
-  update_time_display();
-  
   // APP_LOG(APP_LOG_LEVEL_INFO, "Configuration updated. Active timezones: %d", active_timezone_count);
 }
 
@@ -800,68 +1585,81 @@ static void outbox_sent_callback(DictionaryIterator *iterator, void *context) {
   // APP_LOG(APP_LOG_LEVEL_INFO, "Outbox send success!");
 }
 
-// Load saved configuration
-static void load_saved_config() {
-  // APP_LOG(APP_LOG_LEVEL_INFO, "Loading saved configuration...");
-  char buffer[30];
-  bool any_config_loaded = false;
-  
-  if (persist_read_string(MESSAGE_KEY_HOME, buffer, sizeof(buffer)) > 0) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Loading HOME timezone: %s", buffer);
-    load_timezone_config(1, buffer);  // Slot 1 = Home
-    any_config_loaded = true;
-  }
-  
-  if (persist_read_string(MESSAGE_KEY_TIMEZONE_1, buffer, sizeof(buffer)) > 0) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Loading TIMEZONE_1: %s", buffer);
-    load_timezone_config(2, buffer);  // Slot 2 = Timezone 3
-    any_config_loaded = true;
-  }
-  
-  if (persist_read_string(MESSAGE_KEY_TIMEZONE_2, buffer, sizeof(buffer)) > 0) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Loading TIMEZONE_2: %s", buffer);
-    load_timezone_config(3, buffer);  // Slot 3 = Timezone 4
-    any_config_loaded = true;
-  }
-  
-  if (persist_read_string(MESSAGE_KEY_TIMEZONE_3, buffer, sizeof(buffer)) > 0) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Loading TIMEZONE_3: %s", buffer);
-    load_timezone_config(4, buffer);  // Slot 4 = Timezone 5
-    any_config_loaded = true;
-  }
-  
-  if (persist_read_string(MESSAGE_KEY_TIMEZONE_4, buffer, sizeof(buffer)) > 0) {
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Loading TIMEZONE_4: %s", buffer);
-    load_timezone_config(5, buffer);  // Slot 5 = Timezone 6
-    any_config_loaded = true;
+// Reads the per-setting layout of earlier versions, then deletes its keys. Returns
+// whether any setting was found.
+static bool load_legacy_settings(void) {
+  bool found = false;
+  for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+    if (load_legacy_zone(slot)) {
+      found = true;
+    }
   }
   
-  // Load always show home setting
   if (persist_exists(MESSAGE_KEY_ALWAYS_SHOW_HOME)) {
     always_show_home = persist_read_bool(MESSAGE_KEY_ALWAYS_SHOW_HOME);
-    // APP_LOG(APP_LOG_LEVEL_INFO, "Loaded ALWAYS_SHOW_HOME: %s", always_show_home ? "true" : "false");
+    found = true;
   }
-  
-  // Load color settings
-  if (persist_exists(MESSAGE_KEY_BACKGROUND_COLOR)) {
-    background_color = hex_to_gcolor(persist_read_int(MESSAGE_KEY_BACKGROUND_COLOR));
+  if (persist_exists(MESSAGE_KEY_SHOW_SECONDS)) {
+    show_seconds = persist_read_bool(MESSAGE_KEY_SHOW_SECONDS);
+    found = true;
+  }
+  if (persist_exists(MESSAGE_KEY_SHOW_HOME_SECONDS)) {
+    show_home_seconds = persist_read_bool(MESSAGE_KEY_SHOW_HOME_SECONDS);
+    found = true;
   }
-  if (persist_exists(MESSAGE_KEY_TIME_COLOR)) {
-    time_color = hex_to_gcolor(persist_read_int(MESSAGE_KEY_TIME_COLOR));
+  if (persist_exists(MESSAGE_KEY_SECONDS_WINDOW)) {
+    seconds_window = persist_read_int(MESSAGE_KEY_SECONDS_WINDOW);
+    found = true;
   }
-  if (persist_exists(MESSAGE_KEY_TIMEZONE_LABEL_COLOR)) {
-    timezone_label_color = hex_to_gcolor(persist_read_int(MESSAGE_KEY_TIMEZONE_LABEL_COLOR));
+  for (int i = 0; i < 3; i++) {
+    if (persist_exists(power_threshold_key(i))) {
+      power_thresholds[i] = persist_read_int(power_threshold_key(i));
+      found = true;
+    }
   }
-  if (persist_exists(MESSAGE_KEY_HOME_TIME_COLOR)) {
-    home_time_color = hex_to_gcolor(persist_read_int(MESSAGE_KEY_HOME_TIME_COLOR));
+  if (persist_exists(MESSAGE_KEY_POWER_SAVE_ASLEEP)) {
+    power_save_asleep = persist_read_bool(MESSAGE_KEY_POWER_SAVE_ASLEEP);
+    found = true;
+  }
+  s_config_revision = persist_read_int(PERSIST_KEY_CONFIG_REVISION);  // 0 if never configured
+  
+  // Colors
+  const uint32_t color_keys[4] = {
+    MESSAGE_KEY_BACKGROUND_COLOR, MESSAGE_KEY_TIME_COLOR,
+    MESSAGE_KEY_TIMEZONE_LABEL_COLOR, MESSAGE_KEY_HOME_TIME_COLOR
+  };
+  for (int i = 0; i < 4; i++) {
+    if (persist_exists(color_keys[i])) {
+      s_settings.colors[i] = persist_read_int(color_keys[i]);
+      found = true;
+    }
   }
+  apply_setting_colors();
   
-  // Load display options
-  if (persist_exists(MESSAGE_KEY_SHOW_SECONDS)) {
-    show_seconds = persist_read_bool(MESSAGE_KEY_SHOW_SECONDS);
+  if (found) {
+    for (int slot = 1; slot < MAX_TIMEZONES; slot++) {
+      persist_delete(PERSIST_KEY_ZONE_ID_BASE + slot);
+      persist_delete(slot_message_key(slot));
+    }
+    for (uint32_t key = MESSAGE_KEY_ALWAYS_SHOW_HOME; key <= MESSAGE_KEY_POWER_SAVE_ASLEEP; key++) {
+      persist_delete(key);
+    }
+    persist_delete(PERSIST_KEY_CONFIG_REVISION);
   }
-  if (persist_exists(MESSAGE_KEY_SHOW_HOME_SECONDS)) {
-    show_home_seconds = persist_read_bool(MESSAGE_KEY_SHOW_HOME_SECONDS);
+  return found;
+}
+
+// Load saved configuration: the Settings record, or the older per-setting keys, which
+// are migrated to a record once
+static void load_saved_config() {
+  // APP_LOG(APP_LOG_LEVEL_INFO, "Loading saved configuration...");
+  // First, so the slots find their zones in these as they are set
+  load_overlay();
+  load_schedule();
+  bool any_config_loaded = load_settings();
+  if (!any_config_loaded && load_legacy_settings()) {
+    save_settings();
+    any_config_loaded = true;
   }
   
   // If no configuration was loaded, set up some test timezones
@@ -872,6 +1670,8 @@ static void load_saved_config() {
     load_timezone_config(3, "Asia/Kolkata");        // Timezone 4 = Mumbai  
     load_timezone_config(4, "Europe/Moscow");       // Timezone 5 = Moscow
     load_timezone_config(5, "Asia/Tokyo");          // Timezone 6 = Tokyo
+    // Saved as a record, so later starts read it instead of probing the legacy keys
+    save_settings();
   }
   
   update_active_timezone_count();
@@ -885,39 +1685,63 @@ static void prv_window_load(Window *window) {
   // Apply background color
   window_set_background_color(window, background_color);
 
-  // Create timezone name layer (larger to accommodate GMT offset)
-  s_timezone_layer = text_layer_create(GRect(0, 35, bounds.size.w, 30));
-  text_layer_set_text_alignment(s_timezone_layer, GTextAlignmentCenter);
-  text_layer_set_font(s_timezone_layer, fonts_get_system_font(FONT_KEY_GOTHIC_14));
-  text_layer_set_text_color(s_timezone_layer, timezone_label_color);
-  text_layer_set_background_color(s_timezone_layer, GColorClear);
-  layer_add_child(window_layer, text_layer_get_layer(s_timezone_layer));
-
-  // Create time layer (adjusted position for larger timezone layer)
-  s_time_layer = text_layer_create(GRect(0, 75, bounds.size.w, 40));
-  text_layer_set_text_alignment(s_time_layer, GTextAlignmentCenter);
-  text_layer_set_font(s_time_layer, fonts_get_system_font(FONT_KEY_LECO_26_BOLD_NUMBERS_AM_PM));
-  text_layer_set_text_color(s_time_layer, time_color);
-  text_layer_set_background_color(s_time_layer, GColorClear);
-  layer_add_child(window_layer, text_layer_get_layer(s_time_layer));
-
-  // Create home time layer (smaller font, positioned below main time)
-  s_home_time_layer = text_layer_create(GRect(0, 125, bounds.size.w, 25));
-  text_layer_set_text_alignment(s_home_time_layer, GTextAlignmentCenter);
-  text_layer_set_font(s_home_time_layer, fonts_get_system_font(FONT_KEY_GOTHIC_14));
-  text_layer_set_text_color(s_home_time_layer, home_time_color);
-  text_layer_set_background_color(s_home_time_layer, GColorClear);
-  layer_add_child(window_layer, text_layer_get_layer(s_home_time_layer));
-  layer_set_hidden(text_layer_get_layer(s_home_time_layer), true); // Initially hidden
+  // Timezone name (tall enough for the GMT offset), time, and home time below it
+  s_line_frames[LINE_LABEL] = GRect(0, 35, bounds.size.w, 30);
+  s_line_frames[LINE_TIME] = GRect(0, 75, bounds.size.w, 40);
+  s_line_frames[LINE_HOME] = GRect(0, 125, bounds.size.w, 25);
+  s_line_frames[LINE_TIME_SECONDS] = s_line_frames[LINE_TIME];
+  s_line_frames[LINE_HOME_SECONDS] = s_line_frames[LINE_HOME];
+  s_line_fonts[LINE_LABEL] = fonts_get_system_font(FONT_KEY_GOTHIC_14);
+  s_line_fonts[LINE_TIME] = fonts_get_system_font(FONT_KEY_LECO_26_BOLD_NUMBERS_AM_PM);
+  s_line_fonts[LINE_HOME] = s_line_fonts[LINE_LABEL];
+  s_line_fonts[LINE_TIME_SECONDS] = s_line_fonts[LINE_TIME];
+  s_line_fonts[LINE_HOME_SECONDS] = s_line_fonts[LINE_HOME];
+
+  // The home line and the seconds lines start hidden
+#if SINGLE_LAYER_RENDERER
+  for (int line = 0; line < LINE_COUNT; line++) {
+    GRect frame = s_line_frames[line];
+    frame.origin.y -= CANVAS_TOP;
+    s_canvas_lines[line] = (CanvasLine) { frame, GTextAlignmentCenter, line < LINE_HOME };
+  }
+  s_canvas_layer = layer_create(GRect(0, CANVAS_TOP, bounds.size.w, 125 + 25 - CANVAS_TOP));
+  layer_set_update_proc(s_canvas_layer, canvas_update_proc);
+  layer_add_child(window_layer, s_canvas_layer);
+  for (int i = 0; i < 2; i++) {
+    s_seconds_layers[i] = layer_create(s_canvas_lines[LINE_TIME_SECONDS + i].frame);
+    layer_set_update_proc(s_seconds_layers[i], seconds_update_proc);
+    layer_add_child(s_canvas_layer, s_seconds_layers[i]);
+  }
+#else
+  for (int line = 0; line < LINE_COUNT; line++) {
+    TextLayer *layer = text_layer_create(s_line_frames[line]);
+    text_layer_set_text_alignment(layer, GTextAlignmentCenter);
+    text_layer_set_font(layer, s_line_fonts[line]);
+    text_layer_set_text_color(layer, line_color(line));
+    text_layer_set_background_color(layer, GColorClear);
+    layer_add_child(window_layer, text_layer_get_layer(layer));
+    layer_set_hidden(text_layer_get_layer(layer), line >= LINE_HOME);
+    s_line_layers[line] = layer;
+  }
+#endif
 
   // Initialize display
   update_time_display();
 }
 
 static void prv_window_unload(Window *window) {
-  text_layer_destroy(s_timezone_layer);
-  text_layer_destroy(s_time_layer);
-  text_layer_destroy(s_home_time_layer);
+#if SINGLE_LAYER_RENDERER
+  for (int i = 0; i < 2; i++) {
+    layer_destroy(s_seconds_layers[i]);
+    s_seconds_layers[i] = NULL;
+  }
+  layer_destroy(s_canvas_layer);
+  s_canvas_layer = NULL;
+#else
+  for (int line = 0; line < LINE_COUNT; line++) {
+    text_layer_destroy(s_line_layers[line]);
+  }
+#endif
   // s_hint_layer removed
 }
 
@@ -935,14 +1759,17 @@ static void prv_init(void) {
   });
   
   // Load saved configuration
-  load_saved_config();
+  load_saved_config();  
+  // Battery and sleep state drive the power governor
+  s_battery = battery_state_service_peek();
+  s_power_tier = power_tier_for_state();
+  battery_state_service_subscribe(battery_handler);
+#if defined(PBL_HEALTH)
+  health_service_events_subscribe(health_handler, NULL);
+#endif
   
   // Subscribe to time updates (seconds if needed, otherwise minutes)
-  if (show_seconds || show_home_seconds) {
-    tick_timer_service_subscribe(SECOND_UNIT, tick_handler);
-  } else {
-    tick_timer_service_subscribe(MINUTE_UNIT, tick_handler);
-  }
+  update_tick_subscription();
   
   // Subscribe to accelerometer tap service
   accel_tap_service_subscribe(tap_handler);
@@ -954,8 +1781,11 @@ static void prv_init(void) {
   app_message_register_outbox_sent(outbox_sent_callback);
   
   // Open AppMessage
-  const int inbox_size = 256;
-  const int outbox_size = 256;
+  // The largest message is a SCHEDULE tuple of up to 148 bytes, 156 with its headers (a
+  // full OVERLAY is 130, a full CONFIG 42); the watch only ever sends its
+  // CONFIG_REVISION back
+  const int inbox_size = 160;
+  const int outbox_size = 16;
   app_message_open(inbox_size, outbox_size);
   // APP_LOG(APP_LOG_LEVEL_INFO, "AppMessage opened with inbox_size=%d, outbox_size=%d", inbox_size, outbox_size);
   
@@ -969,6 +1799,13 @@ static void prv_deinit(void) {
   // Unsubscribe from services
   tick_timer_service_unsubscribe();
   accel_tap_service_unsubscribe();
+  battery_state_service_unsubscribe();
+#if defined(PBL_HEALTH)
+  health_service_events_unsubscribe();
+#endif
+  if (s_seconds_timer) {
+    app_timer_cancel(s_seconds_timer);
+  }
   
   window_destroy(s_window);
 }
@@ -980,4 +1817,5 @@ int main(void) {
 
   app_event_loop();
   prv_deinit();
+  return 0;
 }
@@ -1,15 +1,407 @@
 // Configuration page for Timezone Traveler
 
 var Clay = require('pebble-clay');
-var clayConfigurator = require('./config')
-var timeZoneOptions = require('../shared/timezones.canonical');
-var timeZoneMapper = require('../shared/timezones.mapper');
+var clayConfigurator = require('./config');
+var zonePicker = require('./picker');
+// Picker zone list and the zone id of each entry, generated by utility/timezone_tool.py
+var timeZoneBundle = require('../shared/timezones.bundle');
+
+// Numeric zone ids, matching the ids in the watch's TIMEZONE_DB resource. Only saves
+// and schedule refreshes need them, so they are read out of the bundle on first use.
+var timeZoneIds = null;
+var timeZoneIdentifiers = null;
+
+function loadZoneIds() {
+  if (timeZoneIds) {
+    return;
+  }
+  timeZoneIds = {};
+  timeZoneIdentifiers = {};
+  var index = 0;
+  timeZoneBundle.zones.split('.').forEach(function(entry) {
+    var star = entry.indexOf('*');
+    var region = entry.slice(0, star);
+    entry.slice(star + 1).split('!').forEach(function(zone) {
+      var identifier = (region ? region + '/' : '') + zone.slice(0, zone.indexOf('~'));
+      var id = timeZoneBundle.ids[index++];
+      timeZoneIds[identifier] = id;
+      timeZoneIdentifiers[id] = identifier;
+    });
+  });
+}
+
+// Packed configuration for the CONFIG message key. The layout is documented with
+// apply_config_blob() in main.c: version, section mask, base and new revision, then
+// the sections present, in order.
+var CONFIG_BLOB_VERSION = 2;
+var CONFIG_SECTION_ZONES = 0x01;
+var CONFIG_SECTION_DISPLAY = 0x02;
+var CONFIG_SECTION_COLORS = 0x04;
+var CONFIG_SECTION_POWER = 0x08;
+var CONFIG_SECTIONS = [CONFIG_SECTION_ZONES, CONFIG_SECTION_DISPLAY, CONFIG_SECTION_COLORS, CONFIG_SECTION_POWER];
+var ZONE_KEYS = ['HOME', 'TIMEZONE_1', 'TIMEZONE_2', 'TIMEZONE_3', 'TIMEZONE_4'];
+var COLOR_KEYS = ['BACKGROUND_COLOR', 'TIME_COLOR', 'TIMEZONE_LABEL_COLOR', 'HOME_TIME_COLOR'];
+var POWER_KEYS = ['POWER_NO_SECONDS_BELOW', 'POWER_FREEZE_HOME_BELOW', 'POWER_HOURLY_BELOW'];
+
+// localStorage: the encoded sections of the last save, and the revision and sections
+// of the last blob the watch acknowledged
+var DESIRED_CONFIG_KEY = 'desiredConfig';
+var ACKED_CONFIG_KEY = 'ackedConfig';
+
+// Offset schedule for the SCHEDULE message key: every offset change of the configured
+// zones over the next year, from the phone's IANA rules. The layout is documented with
+// get_scheduled_offset() in main.c. Times and offsets are in quarter hours.
+var SCHEDULE_VERSION = 1;
+var SCHEDULE_DAYS = 365;
+var SCHEDULE_REFRESH_DAYS = 30;  // On app start, resend a schedule this old
+var SCHEDULE_MAX_CHANGES = 8;    // Per zone, as on the watch
+var QUARTER_HOUR_MS = 15 * 60 * 1000;
+var DAY_MS = 24 * 60 * 60 * 1000;
+// localStorage: start and zone ids of the last schedule the watch acknowledged
+var SENT_SCHEDULE_KEY = 'sentSchedule';
+
+// Zone table overlay for the OVERLAY message key: (zone id, base offset, rule) records
+// the watch applies over its compiled table, documented with find_overlay_record() in
+// main.c. Only the watch knows its compiled rules, so every configured zone the phone
+// sees at one offset for the whole schedule gets a fixed-offset record; that corrects
+// zones whose DST was abolished or whose offset moved after the app was built, also
+// once the schedule has expired.
+var OVERLAY_VERSION = 1;
+var OVERLAY_RULE_NONE = 0;  // DST_RULE_NONE
+var SENT_OVERLAY_KEY = 'sentOverlay';  // Bytes of the last overlay the watch acknowledged
+
+function clampByte(value) {
+  return Math.max(0, Math.min(255, parseInt(value, 10) || 0));
+}
+
+// Clay reports colors as integers, but accept "RRGGBB" strings too
+function colorValue(value) {
+  return (typeof value === 'string' ? parseInt(value, 16) : value) & 0xFFFFFF;
+}
+
+// getCfg(name) reads a setting by message key name; returns each section's bytes,
+// keyed by its CONFIG_SECTION_* bit
+function encodeSections(getCfg) {
+  loadZoneIds();
+  var sections = {};
+  var zones = [];
+  ZONE_KEYS.forEach(function(key) {
+    var id = timeZoneIds[getCfg(key)] || 0;  // Unknown or "None" disables the slot
+    zones.push(id & 0xFF, id >> 8);
+  });
+  sections[CONFIG_SECTION_ZONES] = zones;
+  sections[CONFIG_SECTION_DISPLAY] = [
+    (getCfg('ALWAYS_SHOW_HOME') ? 0x01 : 0) |
+    (getCfg('SHOW_SECONDS') ? 0x02 : 0) |
+    (getCfg('SHOW_HOME_SECONDS') ? 0x04 : 0),
+    clampByte(getCfg('SECONDS_WINDOW'))
+  ];
+  var colors = [];
+  COLOR_KEYS.forEach(function(key) {
+    var color = colorValue(getCfg(key));
+    colors.push(color >> 16, (color >> 8) & 0xFF, color & 0xFF);
+  });
+  sections[CONFIG_SECTION_COLORS] = colors;
+  var power = POWER_KEYS.map(function(key) {
+    return clampByte(getCfg(key));
+  });
+  power.push(getCfg('POWER_SAVE_ASLEEP') ? 0x01 : 0);
+  sections[CONFIG_SECTION_POWER] = power;
+  return sections;
+}
+
+function loadStored(key) {
+  try {
+    return JSON.parse(localStorage.getItem(key));
+  } catch (e) {
+    return null;
+  }
+}
+
+function sameBytes(a, b) {
+  return a && b && a.join(',') === b.join(',');
+}
+
+// Zone ids of the ZONES section bytes, Home first
+function zoneIdsOf(sections) {
+  var bytes = sections[CONFIG_SECTION_ZONES];
+  var ids = [];
+  for (var i = 0; i < bytes.length; i += 2) {
+    ids.push(bytes[i] | (bytes[i + 1] << 8));
+  }
+  return ids;
+}
+
+// A zone's UTC offset in minutes at time ms, from the wall clock Intl gives for it
+function zoneOffsetMinutes(format, ms) {
+  var fields = {};
+  format.formatToParts(new Date(ms)).forEach(function(part) {
+    fields[part.type] = part.value;
+  });
+  var wall = Date.UTC(+fields.year, fields.month - 1, +fields.day, fields.hour % 24, +fields.minute);
+  return Math.round((wall - ms) / 60000);
+}
+
+// The zone's offset at start and each change over the schedule, or null when this
+// phone cannot resolve the zone or the result does not fit the watch's layout. The
+// zone is sampled daily and each change bisected to the quarter hour, so this assumes
+// no offset changes and back again within one day.
+function zoneSchedule(identifier, start) {
+  var format;
+  try {
+    format = new Intl.DateTimeFormat('en-US', {
+      timeZone: identifier, hourCycle: 'h23',
+      year: 'numeric', month: 'numeric', day: 'numeric', hour: 'numeric', minute: 'numeric'
+    });
+  } catch (e) {
+    return null;
+  }
+  // Older phone JS engines have Intl.DateTimeFormat without formatToParts
+  if (typeof format.formatToParts !== 'function') {
+    return null;
+  }
+  var offset = zoneOffsetMinutes(format, start);
+  var zone = { offset: offset, changes: [] };
+  var end = start + SCHEDULE_DAYS * DAY_MS;
+  for (var lo = start; lo < end; lo += DAY_MS) {
+    var hi = lo + DAY_MS;
+    if (zoneOffsetMinutes(format, hi) === offset) {
+      continue;
+    }
+    var from = lo;
+    while (hi - from > QUARTER_HOUR_MS) {
+      var mid = from + Math.floor((hi - from) / QUARTER_HOUR_MS / 2) * QUARTER_HOUR_MS;
+      if (zoneOffsetMinutes(format, mid) === offset) {
+        from = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    offset = zoneOffsetMinutes(format, hi);
+    if (hi < end) {
+      zone.changes.push({ quarter: (hi - start) / QUARTER_HOUR_MS, offset: offset });
+    }
+  }
+  var offsets = [zone.offset].concat(zone.changes.map(function(change) {
+    return change.offset;
+  }));
+  var fits = zone.changes.length <= SCHEDULE_MAX_CHANGES && offsets.every(function(minutes) {
+    return minutes % 15 === 0 && Math.abs(minutes / 15) < 128;
+  });
+  return fits ? zone : null;
+}
+
+// Schedules of the given zone ids from start, by ascending id, without duplicates and
+// zones this phone cannot resolve
+function zoneSchedules(ids, start) {
+  loadZoneIds();
+  var zones = [];
+  ids.slice().sort(function(a, b) {
+    return a - b;
+  }).forEach(function(id, index, sorted) {
+    if (!id || sorted[index - 1] === id || !timeZoneIdentifiers[id]) {
+      return;
+    }
+    var zone = zoneSchedule(timeZoneIdentifiers[id], start);
+    if (!zone) {
+      console.log('No offset schedule for ' + timeZoneIdentifiers[id] + ', the watch uses its own rules');
+      return;
+    }
+    zone.id = id;
+    zones.push(zone);
+  });
+  return zones;
+}
+
+// Schedule bytes for zone schedules starting at start
+function encodeSchedule(zones, start) {
+  var seconds = start / 1000;
+  var span = SCHEDULE_DAYS * DAY_MS / QUARTER_HOUR_MS;
+  var bytes = [SCHEDULE_VERSION, zones.length, seconds & 0xFF, (seconds >> 8) & 0xFF,
+               (seconds >> 16) & 0xFF, (seconds >>> 24) & 0xFF, span & 0xFF, span >> 8];
+  zones.forEach(function(zone) {
+    bytes.push(zone.id & 0xFF, zone.id >> 8, (zone.offset / 15) & 0xFF, zone.changes.length);
+    zone.changes.forEach(function(change) {
+      bytes.push(change.quarter & 0xFF, change.quarter >> 8, (change.offset / 15) & 0xFF);
+    });
+  });
+  return bytes;
+}
+
+// Overlay bytes: a fixed-offset record for each zone without changes
+function encodeOverlay(zones) {
+  var bytes = [OVERLAY_VERSION, 0];
+  zones.forEach(function(zone) {
+    if (!zone.changes.length) {
+      bytes.push(zone.id & 0xFF, zone.id >> 8, zone.offset & 0xFF, (zone.offset >> 8) & 0xFF, OVERLAY_RULE_NONE);
+      bytes[1]++;
+    }
+  });
+  return bytes;
+}
+
+// Computes and sends the schedule for the zones of the last save, then the overlay
+// derived from it if that differs from the last one acknowledged. Unless force is set,
+// only when the zones changed or the last schedule sent is SCHEDULE_REFRESH_DAYS old.
+function sendZoneData(force) {
+  var desired = loadStored(DESIRED_CONFIG_KEY);
+  if (!desired) {
+    return;
+  }
+  var ids = zoneIdsOf(desired);
+  var now = Date.now();
+  var sent = loadStored(SENT_SCHEDULE_KEY);
+  if (!force && sent && sent.zones.join(',') === ids.join(',') &&
+      now - sent.start < SCHEDULE_REFRESH_DAYS * DAY_MS) {
+    return;
+  }
+  var start = Math.floor(now / QUARTER_HOUR_MS) * QUARTER_HOUR_MS;
+  var zones = zoneSchedules(ids, start);
+  queueMessage({ SCHEDULE: encodeSchedule(zones, start) },
+    function() {
+      localStorage.setItem(SENT_SCHEDULE_KEY, JSON.stringify({ start: start, zones: ids }));
+      console.log('Offset schedule sent successfully!');
+    },
+    function(e) {
+      console.error('Failed to send offset schedule:', e.error.message);
+    }
+  );
+  var overlay = encodeOverlay(zones);
+  var sentOverlay = loadStored(SENT_OVERLAY_KEY) || [OVERLAY_VERSION, 0];
+  if (sameBytes(sentOverlay, overlay)) {
+    return;
+  }
+  queueMessage({ OVERLAY: overlay },
+    function() {
+      localStorage.setItem(SENT_OVERLAY_KEY, JSON.stringify(overlay));
+      console.log('Zone overlay sent successfully! Records: ' + overlay[1]);
+    },
+    function(e) {
+      console.error('Failed to send zone overlay:', e.error.message);
+    }
+  );
+}
+
+// Messages go out one at a time; each waits for the previous one's ack or nack
+var outbox = [];
+
+function sendNextMessage() {
+  var message = outbox[0];
+  function done(callback) {
+    return function(e) {
+      outbox.shift();
+      callback(e);
+      if (outbox.length) {
+        sendNextMessage();
+      }
+    };
+  }
+  Pebble.sendAppMessage(message.payload, done(message.success), done(message.failure));
+}
+
+function queueMessage(payload, success, failure) {
+  outbox.push({ payload: payload, success: success, failure: failure });
+  if (outbox.length === 1) {
+    sendNextMessage();
+  }
+}
+
+var fullResyncSent = false;  // The last blob sent was a full one (base revision 0)
+// Revision and sections of the newest blob queued this session. The watch applies blobs
+// in order, so a delta builds on this one even before it is acknowledged.
+var sentConfig = null;
+
+// The blob the watch will hold once everything queued has applied
+function latestConfig() {
+  return sentConfig || loadStored(ACKED_CONFIG_KEY);
+}
+
+// Sends the sections that differ from the latest blob, or all of them (a full resync)
+// when full is set or nothing has been acknowledged yet
+function sendConfig(sections, full) {
+  var latest = full ? null : latestConfig();
+  var mask = 0;
+  CONFIG_SECTIONS.forEach(function(bit) {
+    if (!latest || !sameBytes(latest.sections[bit], sections[bit])) {
+      mask |= bit;
+    }
+  });
+  var base = latest ? latest.revision : 0;
+  if (!mask) {
+    // Nothing changed here, but the watch may have been reset since: a header with no
+    // sections checks that it holds the base revision, and is answered if it does not
+    var check = [CONFIG_BLOB_VERSION, 0, base & 0xFF, base >> 8, base & 0xFF, base >> 8];
+    queueMessage({ CONFIG: check },
+      function() {
+        console.log('Configuration unchanged, revision ' + base + ' checked');
+      },
+      function(e) {
+        console.error('Failed to check configuration revision:', e.error.message);
+      }
+    );
+    return;
+  }
+  var revision = latest ? latest.revision % 0xFFFF + 1 : 1 + Math.floor(Math.random() * 0xFFFF);
+  var bytes = [CONFIG_BLOB_VERSION, mask, base & 0xFF, base >> 8, revision & 0xFF, revision >> 8];
+  CONFIG_SECTIONS.forEach(function(bit) {
+    if (mask & bit) {
+      bytes = bytes.concat(sections[bit]);
+    }
+  });
+  fullResyncSent = !latest;
+  sentConfig = { revision: revision, sections: sections };
+  queueMessage({ CONFIG: bytes },
+    function() {
+      localStorage.setItem(ACKED_CONFIG_KEY, JSON.stringify({ revision: revision, sections: sections }));
+      console.log('Configuration sent successfully! Sections: ' + mask);
+    },
+    function(e) {
+      // The watch may or may not hold this blob, so the next save is a full one; blobs
+      // already queued on top of it are rejected and answered with a resync
+      sentConfig = null;
+      localStorage.removeItem(ACKED_CONFIG_KEY);
+      console.error('Failed to send configuration:', e.error.message);
+    }
+  );
+}
+
+// The watch answers a blob it could not apply with the revision it holds. Unless
+// that is the latest one sent here, resend everything from the last save.
+Pebble.addEventListener('appmessage', function(e) {
+  var reported = e.payload.CONFIG_REVISION;
+  if (typeof reported === 'undefined') {
+    return;
+  }
+  var latest = latestConfig();
+  if (latest && latest.revision === reported) {
+    return;
+  }
+  sentConfig = null;
+  localStorage.removeItem(ACKED_CONFIG_KEY);
+  var desired = loadStored(DESIRED_CONFIG_KEY);
+  if (fullResyncSent || !desired) {
+    console.error('Watch rejected the full configuration (revision ' + reported + ')');
+    return;
+  }
+  console.log('Watch holds config revision ' + reported + ', resyncing');
+  sendConfig(desired, true);
+});
+
 // Inline message keys to avoid webpack path issues
 var messageKeys = {
     "ALWAYS_SHOW_HOME": 10005,
     "BACKGROUND_COLOR": 10006,
+    "CONFIG": 10017,
+    "CONFIG_REVISION": 10018,
     "HOME": 10000,
     "HOME_TIME_COLOR": 10009,
+    "OVERLAY": 10020,
+    "POWER_FREEZE_HOME_BELOW": 10014,
+    "POWER_HOURLY_BELOW": 10015,
+    "POWER_NO_SECONDS_BELOW": 10013,
+    "POWER_SAVE_ASLEEP": 10016,
+    "SCHEDULE": 10019,
+    "SECONDS_WINDOW": 10012,
     "SHOW_HOME_SECONDS": 10011,
     "SHOW_SECONDS": 10010,
     "TIMEZONE_1": 10001,
@@ -20,19 +412,66 @@ var messageKeys = {
     "TIME_COLOR": 10007
 };
 
-// Create configuration directly instead of using external config.js
-var clayConfig = clayConfigurator(timeZoneMapper(timeZoneOptions));
+// The zone pickers share one compact zone list, passed to the page as user data
+var clayConfig = clayConfigurator();
+var clay = new Clay(clayConfig, zonePicker, {
+  autoHandleEvents: false,
+  userData: { zones: timeZoneBundle.zones }
+});
+
+// The generated config page is cached in localStorage with the settings it shows. It
+// is reused while the zone dataset (the bundle's hash), the page source (config items
+// and picker, standing in for the app version, which pkjs cannot read), the watch
+// platform and Clay's stored settings are all unchanged.
+var CONFIG_PAGE_KEY = 'configPage';  // { key, settings, url }
+var CLAY_SETTINGS_KEY = 'clay-settings';  // Where Clay keeps the settings the page shows
+var configPageSource = null;  // Hash of the page source, computed on first open
+
+// FNV-1a, as 8 hex digits
+function hashString(text) {
+  var hash = 0x811C9DC5;
+  for (var i = 0; i < text.length; i++) {
+    hash ^= text.charCodeAt(i);
+    hash += (hash << 1) + (hash << 4) + (hash << 7) + (hash << 8) + (hash << 24);  // * 0x01000193
+  }
+  return ('0000000' + (hash >>> 0).toString(16)).slice(-8);
+}
+
+function watchPlatform() {
+  try {
+    return Pebble.getActiveWatchInfo().platform;
+  } catch (e) {
+    return 'unknown';
+  }
+}
 
-var clay = new Clay(clayConfig, function(minified) {
-  // Return custom success page HTML
-  return '<!DOCTYPE html><html><head><meta charset="utf-8"><meta name="viewport" content="width=device-width, initial-scale=1"><title>Settings Saved</title><style>body{font-family:Arial,sans-serif;text-align:center;padding:40px 20px;background:#f0f0f0}.success{background:#4CAF50;color:white;padding:20px;border-radius:10px;margin:20px 0;font-size:18px}.instructions{margin:20px 0;color:#666;line-height:1.5}.btn{background:#2196F3;color:white;border:none;padding:15px 30px;font-size:16px;border-radius:5px;cursor:pointer;margin-top:20px}</style></head><body><div class="success">✓ Configuration Saved</div><div class="instructions">Your timezone settings have been updated!<br><br><strong>Navigation:</strong><br>• Tap anywhere on the watch to turn on backlight and cycle through timezones</div><button class="btn" onclick="document.location=\'pebblejs://close\'">Close</button></body></html>';
-}, {
-  autoHandleEvents: false
+function configPageUrl() {
+  if (!configPageSource) {
+    configPageSource = hashString(JSON.stringify(clayConfig) + zonePicker.toString());
+  }
+  var key = [timeZoneBundle.hash, configPageSource, watchPlatform()].join(':');
+  var settings = localStorage.getItem(CLAY_SETTINGS_KEY);
+  var cached = loadStored(CONFIG_PAGE_KEY);
+  if (cached && cached.key === key && cached.settings === settings) {
+    return cached.url;
+  }
+  var url = clay.generateUrl();
+  try {
+    localStorage.setItem(CONFIG_PAGE_KEY, JSON.stringify({ key: key, settings: settings, url: url }));
+  } catch (e) {
+    console.log('Config page not cached: ' + e.message);
+  }
+  return url;
+}
+
+// Refresh the offset schedule before the one on the watch runs out
+Pebble.addEventListener('ready', function() {
+  sendZoneData(false);
 });
 
 // Configuration event listeners
 Pebble.addEventListener('showConfiguration', function(e) {
-  Pebble.openURL(clay.generateUrl());
+  Pebble.openURL(configPageUrl());
 });
 
 Pebble.addEventListener('webviewclosed', function(e) {
@@ -40,9 +479,6 @@ Pebble.addEventListener('webviewclosed', function(e) {
     // Parse configuration
     var config = clay.getSettings(e.response);
     
-    // Build AppMessage
-    var message = {};
-    
     // Map message key names to IDs using the inlined mapping
     function getCfg(name) {
       var id = messageKeys[name];
@@ -50,56 +486,12 @@ Pebble.addEventListener('webviewclosed', function(e) {
       return config[String(id)];
     }
 
-    if (getCfg('HOME')) {
-      message.HOME = getCfg('HOME');
-    }
-    if (getCfg('TIMEZONE_1')) {
-      message.TIMEZONE_1 = getCfg('TIMEZONE_1');
-    }
-    if (getCfg('TIMEZONE_2')) {
-      message.TIMEZONE_2 = getCfg('TIMEZONE_2');
-    }
-    if (getCfg('TIMEZONE_3')) {
-      message.TIMEZONE_3 = getCfg('TIMEZONE_3');
-    }
-    if (getCfg('TIMEZONE_4')) {
-      message.TIMEZONE_4 = getCfg('TIMEZONE_4');
-    }
-    if (typeof getCfg('ALWAYS_SHOW_HOME') !== 'undefined') {
-      message.ALWAYS_SHOW_HOME = getCfg('ALWAYS_SHOW_HOME') ? 1 : 0;
-    }
-    // Color processing - Clay provides colors as integers already
-    if (getCfg('BACKGROUND_COLOR') !== null && getCfg('BACKGROUND_COLOR') !== undefined) {
-      var bgColor = getCfg('BACKGROUND_COLOR');
-      message.BACKGROUND_COLOR = bgColor; // Use directly as integer
-    }
-    if (getCfg('TIME_COLOR') !== null && getCfg('TIME_COLOR') !== undefined) {
-      var timeColor = getCfg('TIME_COLOR');
-      message.TIME_COLOR = timeColor;
-    }
-    if (getCfg('TIMEZONE_LABEL_COLOR') !== null && getCfg('TIMEZONE_LABEL_COLOR') !== undefined) {
-      var tzLabelColor = getCfg('TIMEZONE_LABEL_COLOR');
-      message.TIMEZONE_LABEL_COLOR = tzLabelColor;
-    }
-    if (getCfg('HOME_TIME_COLOR') !== null && getCfg('HOME_TIME_COLOR') !== undefined) {
-      var homeTimeColor = getCfg('HOME_TIME_COLOR');
-      message.HOME_TIME_COLOR = homeTimeColor;
-    }
-    if (typeof getCfg('SHOW_SECONDS') !== 'undefined') {
-      message.SHOW_SECONDS = getCfg('SHOW_SECONDS') ? 1 : 0;
-    }
-    if (typeof getCfg('SHOW_HOME_SECONDS') !== 'undefined') {
-      message.SHOW_HOME_SECONDS = getCfg('SHOW_HOME_SECONDS') ? 1 : 0;
-    }    
-    // Send to watch
-    Pebble.sendAppMessage(message,
-      function() {
-        console.log('Configuration sent successfully!');
-      },
-      function(e) {
-        console.error('Failed to send configuration:', e.error.message);
-      }
-    );
+    // Send only the sections that changed since the watch last acknowledged one
+    var sections = encodeSections(getCfg);
+    localStorage.setItem(DESIRED_CONFIG_KEY, JSON.stringify(sections));
+    sendConfig(sections, false);
+    sendZoneData(true);
+    configPageUrl();  // Cache the page with the new settings now, not at the next open
   } else {
     console.log('Configuration closed without changes');
   }
@@ -0,0 +1,170 @@
+// Timezone picker for the Clay config page. Clay serializes this function into the page
+// and runs it there, so it can only use what the page provides: the zone list arrives
+// once as meta.userData.zones (from shared/timezones.bundle.js, generated by
+// utility/timezone_tool.py), and nothing is parsed or drawn until a picker is first
+// opened.
+module.exports = function(minified) {
+  var clayConfig = this;
+  var ZONE_KEYS = ['HOME', 'TIMEZONE_1', 'TIMEZONE_2', 'TIMEZONE_3', 'TIMEZONE_4'];
+  var MAX_RESULTS = 40;
+  var regions = null;  // [{ name, zones: [{ value, label, key }] }], parsed on first open
+  var openPicker = null;
+
+  function formatOffset(minutes) {
+    var sign = minutes < 0 ? '-' : '+';
+    minutes = Math.abs(minutes);
+    var hours = Math.floor(minutes / 60);
+    var rest = minutes % 60;
+    return 'GMT ' + sign + (hours < 10 ? '0' : '') + hours + ':' + (rest < 10 ? '0' : '') + rest;
+  }
+
+  function parseZones() {
+    regions = clayConfig.meta.userData.zones.split('.').map(function(entry) {
+      var star = entry.indexOf('*');
+      var name = entry.slice(0, star);
+      return {
+        name: name || 'Other',
+        zones: entry.slice(star + 1).split('!').map(function(zone) {
+          var tilde = zone.indexOf('~');
+          var value = (name ? name + '/' : '') + zone.slice(0, tilde);
+          return {
+            value: value,
+            label: value + ' (' + formatOffset(parseInt(zone.slice(tilde + 1), 10)) + ')',
+            key: value.toLowerCase().replace(/_/g, ' ')
+          };
+        })
+      };
+    });
+  }
+
+  function addStyle() {
+    var style = document.createElement('style');
+    style.textContent =
+      '.tz-picker{padding:0 0.75rem 0.75rem}' +
+      '.tz-picker input{width:100%;box-sizing:border-box;padding:0.5rem;font-size:1rem}' +
+      '.tz-row{padding:0.6rem 0.25rem;border-bottom:1px solid rgba(255,255,255,0.1);cursor:pointer}' +
+      '.tz-row.tz-note{cursor:default;opacity:0.6}';
+    document.head.appendChild(style);
+  }
+
+  // One row per entry; entries with a select function are tappable
+  function showRows(list, entries) {
+    list.innerHTML = '';
+    entries.forEach(function(entry) {
+      var row = document.createElement('div');
+      row.className = 'tz-row' + (entry.select ? '' : ' tz-note');
+      row.textContent = entry.label;
+      if (entry.select) {
+        row.addEventListener('click', entry.select);
+      }
+      list.appendChild(row);
+    });
+  }
+
+  function createPicker(item) {
+    var picker = document.createElement('div');
+    picker.className = 'tz-picker';
+    var search = document.createElement('input');
+    search.type = 'search';
+    search.placeholder = 'Search city or region';
+    var list = document.createElement('div');
+    picker.appendChild(search);
+    picker.appendChild(list);
+
+    function choose(value) {
+      return function() {
+        item.set(value);
+        close();
+      };
+    }
+
+    function zoneRows(zones) {
+      return zones.map(function(zone) {
+        return { label: zone.label, select: choose(zone.value) };
+      });
+    }
+
+    function showRegions() {
+      var rows = [{ label: 'None', select: choose('') }];
+      regions.forEach(function(region) {
+        rows.push({ label: region.name + ' (' + region.zones.length + ')', select: function() {
+          showRows(list, [{ label: '‹ All regions', select: showRegions }].concat(zoneRows(region.zones)));
+        } });
+      });
+      showRows(list, rows);
+    }
+
+    function showMatches() {
+      var terms = search.value.toLowerCase().replace(/_/g, ' ').split(/\s+/).filter(Boolean);
+      if (!terms.length) {
+        showRegions();
+        return;
+      }
+      var matches = [];
+      regions.forEach(function(region) {
+        region.zones.forEach(function(zone) {
+          if (terms.every(function(term) { return zone.key.indexOf(term) >= 0; })) {
+            matches.push(zone);
+          }
+        });
+      });
+      var rows = zoneRows(matches.slice(0, MAX_RESULTS));
+      if (matches.length > MAX_RESULTS) {
+        rows.push({ label: (matches.length - MAX_RESULTS) + ' more, keep typing' });
+      } else if (!matches.length) {
+        rows.push({ label: 'No matching timezone' });
+      }
+      showRows(list, rows);
+    }
+
+    function close() {
+      picker.style.display = 'none';
+      openPicker = null;
+    }
+
+    search.addEventListener('input', showMatches);
+    return {
+      element: picker,
+      open: function() {
+        search.value = '';
+        showRegions();
+        picker.style.display = '';
+        openPicker = this;
+      },
+      close: close
+    };
+  }
+
+  function attachPicker(item) {
+    var element = item.$element[0];
+    var input = element.querySelector('input');
+    var picker = null;
+    input.readOnly = true;
+    input.addEventListener('click', function() {
+      if (!regions) {
+        parseZones();
+        addStyle();
+      }
+      if (!picker) {
+        picker = createPicker(item);
+        element.appendChild(picker.element);
+      }
+      var wasOpen = openPicker === picker;
+      if (openPicker) {
+        openPicker.close();
+      }
+      if (!wasOpen) {
+        picker.open();
+      }
+    });
+  }
+
+  clayConfig.on(clayConfig.EVENTS.AFTER_BUILD, function() {
+    ZONE_KEYS.forEach(function(key) {
+      var item = clayConfig.getItemByMessageKey(key);
+      if (item) {
+        attachPicker(item);
+      }
+    });
+  });
+};
@@ -1,392 +1,102 @@
 #ifndef TIMEZONES_H
 #define TIMEZONES_H
 
+#include <stdint.h>
+
 #define SHARED_TIMEZONE_COUNT 374
 
+// Transition tables generated from tzdata for 2025..2037
+#define TZ_TRANSITION_FIRST_YEAR 2025
+#define TZ_TRANSITION_LAST_YEAR 2037
+#define TZ_RULE_COUNT 21
+#define TZ_TRANSITION_COUNT 528
+#define DST_RULE_NONE 0
+#define TZ_PREFIX_COUNT 16
+
+// Layout of the TIMEZONE_DB raw resource (resources/data/timezones.bin)
+#define TZ_DB_ROW_SIZE 10
+#define TZ_DB_MAX_STRING 22
+#define TZ_DB_ROWS_OFFSET 0
+#define TZ_DB_BY_IDENTIFIER_OFFSET 3740
+#define TZ_DB_PREFIXES_OFFSET 4488
+#define TZ_DB_STRINGS_OFFSET 4520
+#define TZ_DB_SIZE 8059
+
 typedef struct {
-  int id;
-  const char *identifier;
-  const char *display_name;
-  const char *abbreviation;
-  const char *offset_str;
-  int offset_minutes;
-} SharedTimezone;
+  uint16_t start;  // first entry in TZ_TRANSITION_TIMES / TZ_TRANSITION_DELTAS
+  uint16_t count;
+} TzRule;
+
+static const TzRule TZ_RULES[TZ_RULE_COUNT] = {
+  {0, 0},  // 0: no transitions
+  {0, 26},  // 1: Africa/Cairo (1 zone)
+  {26, 28},  // 2: Africa/Casablanca (2 zones)
+  {54, 26},  // 3: Africa/Ceuta (60 zones)
+  {80, 26},  // 4: America/Adak (3 zones)
+  {106, 26},  // 5: America/Anchorage (6 zones)
+  {132, 26},  // 6: America/Boise (4 zones)
+  {158, 26},  // 7: America/Chicago (11 zones)
+  {184, 26},  // 8: America/Detroit (16 zones)
+  {210, 26},  // 9: America/Los_Angeles (2 zones)
+  {236, 27},  // 10: Antarctica/Macquarie (10 zones)
+  {263, 27},  // 11: Antarctica/McMurdo (4 zones)
+  {290, 26},  // 12: Antarctica/Troll (1 zone)
+  {316, 26},  // 13: Asia/Beirut (1 zone)
+  {342, 26},  // 14: Asia/Gaza (2 zones)
+  {368, 26},  // 15: Asia/Jerusalem (2 zones)
+  {394, 27},  // 16: Atlantic/Azores (1 zone)
+  {421, 27},  // 17: Australia/Adelaide (4 zones)
+  {448, 27},  // 18: Australia/LHI (2 zones)
+  {475, 26},  // 19: Europe/Chisinau (2 zones)
+  {501, 27},  // 20: Pacific/Norfolk (1 zone)
+};
+
+// UTC instant of each transition, sorted within a rule
+static const int32_t TZ_TRANSITION_TIMES[TZ_TRANSITION_COUNT] = {
+  1745532000, 1761858000, 1776981600, 1793307600, 1809036000, 1824757200, 1840485600, 1856206800, 1871935200, 1887656400, 1903384800, 1919710800, 1934834400, 1951160400, 1966888800, 1982610000, 1998338400, 2014059600, 2029788000, 2045509200, 2061237600, 2076958800, 2092687200, 2109013200, 2124136800, 2140462800,
+  1740276000, 1743904800, 1771120800, 1774144800, 1801965600, 1804989600, 1832205600, 1835834400, 1863050400, 1866074400, 1893290400, 1896919200, 1924135200, 1927159200, 1954980000, 1958004000, 1985220000, 1988848800, 2016064800, 2019088800, 2046304800, 2049933600, 2077149600, 2080778400, 2107994400, 2111018400, 2138234400, 2141863200,
+  1743296400, 1761440400, 1774746000, 1792890000, 1806195600, 1824944400, 1837645200, 1856394000, 1869094800, 1887843600, 1901149200, 1919293200, 1932598800, 1950742800, 1964048400, 1982797200, 1995498000, 2014246800, 2026947600, 2045696400, 2058397200, 2077146000, 2090451600, 2108595600, 2121901200, 2140045200,
+  1741521600, 1762081200, 1772971200, 1793530800, 1805025600, 1825585200, 1836475200, 1857034800, 1867924800, 1888484400, 1899374400, 1919934000, 1930824000, 1951383600, 1962878400, 1983438000, 1994328000, 2014887600, 2025777600, 2046337200, 2057227200, 2077786800, 2088676800, 2109236400, 2120126400, 2140686000,
+  1741518000, 1762077600, 1772967600, 1793527200, 1805022000, 1825581600, 1836471600, 1857031200, 1867921200, 1888480800, 1899370800, 1919930400, 1930820400, 1951380000, 1962874800, 1983434400, 1994324400, 2014884000, 2025774000, 2046333600, 2057223600, 2077783200, 2088673200, 2109232800, 2120122800, 2140682400,
+  1741510800, 1762070400, 1772960400, 1793520000, 1805014800, 1825574400, 1836464400, 1857024000, 1867914000, 1888473600, 1899363600, 1919923200, 1930813200, 1951372800, 1962867600, 1983427200, 1994317200, 2014876800, 2025766800, 2046326400, 2057216400, 2077776000, 2088666000, 2109225600, 2120115600, 2140675200,
+  1741507200, 1762066800, 1772956800, 1793516400, 1805011200, 1825570800, 1836460800, 1857020400, 1867910400, 1888470000, 1899360000, 1919919600, 1930809600, 1951369200, 1962864000, 1983423600, 1994313600, 2014873200, 2025763200, 2046322800, 2057212800, 2077772400, 2088662400, 2109222000, 2120112000, 2140671600,
+  1741503600, 1762063200, 1772953200, 1793512800, 1805007600, 1825567200, 1836457200, 1857016800, 1867906800, 1888466400, 1899356400, 1919916000, 1930806000, 1951365600, 1962860400, 1983420000, 1994310000, 2014869600, 2025759600, 2046319200, 2057209200, 2077768800, 2088658800, 2109218400, 2120108400, 2140668000,
+  1741514400, 1762074000, 1772964000, 1793523600, 1805018400, 1825578000, 1836468000, 1857027600, 1867917600, 1888477200, 1899367200, 1919926800, 1930816800, 1951376400, 1962871200, 1983430800, 1994320800, 2014880400, 2025770400, 2046330000, 2057220000, 2077779600, 2088669600, 2109229200, 2120119200, 2140678800,
+  1735689600, 1743868800, 1759593600, 1775318400, 1791043200, 1806768000, 1822492800, 1838217600, 1853942400, 1869667200, 1885996800, 1901721600, 1917446400, 1933171200, 1948896000, 1964620800, 1980345600, 1996070400, 2011795200, 2027520000, 2043244800, 2058969600, 2075299200, 2091024000, 2106748800, 2122473600, 2138198400,
+  1735689600, 1743861600, 1758981600, 1775311200, 1790431200, 1806760800, 1821880800, 1838210400, 1853330400, 1869660000, 1885384800, 1901714400, 1916834400, 1933164000, 1948284000, 1964613600, 1979733600, 1996063200, 2011183200, 2027512800, 2042632800, 2058962400, 2074687200, 2091016800, 2106136800, 2122466400, 2137586400,
+  1743296400, 1761440400, 1774746000, 1792890000, 1806195600, 1824944400, 1837645200, 1856394000, 1869094800, 1887843600, 1901149200, 1919293200, 1932598800, 1950742800, 1964048400, 1982797200, 1995498000, 2014246800, 2026947600, 2045696400, 2058397200, 2077146000, 2090451600, 2108595600, 2121901200, 2140045200,
+  1743285600, 1761426000, 1774735200, 1792875600, 1806184800, 1824930000, 1837634400, 1856379600, 1869084000, 1887829200, 1901138400, 1919278800, 1932588000, 1950728400, 1964037600, 1982782800, 1995487200, 2014232400, 2026936800, 2045682000, 2058386400, 2077131600, 2090440800, 2108581200, 2121890400, 2140030800,
+  1744416000, 1761346800, 1774656000, 1792796400, 1806105600, 1824850800, 1837555200, 1856300400, 1869004800, 1887750000, 1901059200, 1919199600, 1932508800, 1950649200, 1963958400, 1982703600, 1995408000, 2014153200, 2026857600, 2045602800, 2058307200, 2077052400, 2090361600, 2107897200, 2121811200, 2138742000,
+  1743120000, 1761433200, 1774569600, 1792882800, 1806019200, 1824937200, 1837468800, 1856386800, 1868918400, 1887836400, 1900972800, 1919286000, 1932422400, 1950735600, 1963872000, 1982790000, 1995321600, 2014239600, 2026771200, 2045689200, 2058220800, 2077138800, 2090275200, 2108588400, 2121724800, 2140038000,
+  1735689600, 1743296400, 1761440400, 1774746000, 1792890000, 1806195600, 1824944400, 1837645200, 1856394000, 1869094800, 1887843600, 1901149200, 1919293200, 1932598800, 1950742800, 1964048400, 1982797200, 1995498000, 2014246800, 2026947600, 2045696400, 2058397200, 2077146000, 2090451600, 2108595600, 2121901200, 2140045200,
+  1735689600, 1743870600, 1759595400, 1775320200, 1791045000, 1806769800, 1822494600, 1838219400, 1853944200, 1869669000, 1885998600, 1901723400, 1917448200, 1933173000, 1948897800, 1964622600, 1980347400, 1996072200, 2011797000, 2027521800, 2043246600, 2058971400, 2075301000, 2091025800, 2106750600, 2122475400, 2138200200,
+  1735689600, 1743865200, 1759591800, 1775314800, 1791041400, 1806764400, 1822491000, 1838214000, 1853940600, 1869663600, 1885995000, 1901718000, 1917444600, 1933167600, 1948894200, 1964617200, 1980343800, 1996066800, 2011793400, 2027516400, 2043243000, 2058966000, 2075297400, 2091020400, 2106747000, 2122470000, 2138196600,
+  1743292800, 1761436800, 1774742400, 1792886400, 1806192000, 1824940800, 1837641600, 1856390400, 1869091200, 1887840000, 1901145600, 1919289600, 1932595200, 1950739200, 1964044800, 1982793600, 1995494400, 2014243200, 2026944000, 2045692800, 2058393600, 2077142400, 2090448000, 2108592000, 2121897600, 2140041600,
+  1735689600, 1743865200, 1759590000, 1775314800, 1791039600, 1806764400, 1822489200, 1838214000, 1853938800, 1869663600, 1885993200, 1901718000, 1917442800, 1933167600, 1948892400, 1964617200, 1980342000, 1996066800, 2011791600, 2027516400, 2043241200, 2058966000, 2075295600, 2091020400, 2106745200, 2122470000, 2138194800,
+};
 
-static const SharedTimezone SHARED_TIMEZONES[SHARED_TIMEZONE_COUNT] = {
-  {1, "Africa/Abidjan", "Abidjan", "", "+00:00", 0},
-  {2, "Africa/Accra", "Accra", "", "+00:00", 0},
-  {3, "Africa/Addis_Ababa", "Addis Ababa", "", "+03:00", 180},
-  {4, "Africa/Algiers", "Algiers", "", "+01:00", 60},
-  {5, "Africa/Asmara", "Asmara", "", "+03:00", 180},
-  {6, "Africa/Asmera", "Asmera", "", "+03:00", 180},
-  {7, "Africa/Bamako", "Bamako", "", "+00:00", 0},
-  {8, "Africa/Bangui", "Bangui", "", "+01:00", 60},
-  {9, "Africa/Banjul", "Banjul", "", "+00:00", 0},
-  {10, "Africa/Bissau", "Bissau", "", "+00:00", 0},
-  {11, "Africa/Blantyre", "Blantyre", "", "+02:00", 120},
-  {12, "Africa/Brazzaville", "Brazzaville", "", "+01:00", 60},
-  {13, "Africa/Bujumbura", "Bujumbura", "", "+02:00", 120},
-  {14, "Africa/Cairo", "Cairo", "", "+02:00", 120},
-  {15, "Africa/Casablanca", "Casablanca", "", "+01:00", 60},
-  {16, "Africa/Ceuta", "Ceuta", "", "+01:00", 60},
-  {17, "Africa/Conakry", "Conakry", "", "+00:00", 0},
-  {18, "Africa/Dakar", "Dakar", "", "+00:00", 0},
-  {19, "Africa/Dar_es_Salaam", "Dar es Salaam", "", "+03:00", 180},
-  {20, "Africa/Djibouti", "Djibouti", "", "+03:00", 180},
-  {21, "Africa/Douala", "Douala", "", "+01:00", 60},
-  {22, "Africa/El_Aaiun", "El Aaiun", "", "+01:00", 60},
-  {23, "Africa/Freetown", "Freetown", "", "+00:00", 0},
-  {24, "Africa/Gaborone", "Gaborone", "", "+02:00", 120},
-  {25, "Africa/Harare", "Harare", "", "+02:00", 120},
-  {26, "Africa/Johannesburg", "Johannesburg", "", "+02:00", 120},
-  {27, "Africa/Juba", "Juba", "", "+02:00", 120},
-  {28, "Africa/Kampala", "Kampala", "", "+03:00", 180},
-  {29, "Africa/Khartoum", "Khartoum", "", "+02:00", 120},
-  {30, "Africa/Kigali", "Kigali", "", "+02:00", 120},
-  {31, "Africa/Kinshasa", "Kinshasa", "", "+01:00", 60},
-  {32, "Africa/Lagos", "Lagos", "", "+01:00", 60},
-  {33, "Africa/Libreville", "Libreville", "", "+01:00", 60},
-  {34, "Africa/Lome", "Lome", "", "+00:00", 0},
-  {35, "Africa/Luanda", "Luanda", "", "+01:00", 60},
-  {36, "Africa/Lubumbashi", "Lubumbashi", "", "+02:00", 120},
-  {37, "Africa/Lusaka", "Lusaka", "", "+02:00", 120},
-  {38, "Africa/Malabo", "Malabo", "", "+01:00", 60},
-  {39, "Africa/Maputo", "Maputo", "", "+02:00", 120},
-  {40, "Africa/Maseru", "Maseru", "", "+02:00", 120},
-  {41, "Africa/Mbabane", "Mbabane", "", "+02:00", 120},
-  {42, "Africa/Mogadishu", "Mogadishu", "", "+03:00", 180},
-  {43, "Africa/Monrovia", "Monrovia", "", "+00:00", 0},
-  {44, "Africa/Nairobi", "Nairobi", "", "+03:00", 180},
-  {45, "Africa/Ndjamena", "Ndjamena", "", "+01:00", 60},
-  {46, "Africa/Niamey", "Niamey", "", "+01:00", 60},
-  {47, "Africa/Nouakchott", "Nouakchott", "", "+00:00", 0},
-  {48, "Africa/Ouagadougou", "Ouagadougou", "", "+00:00", 0},
-  {49, "Africa/Porto-Novo", "Porto-Novo", "", "+01:00", 60},
-  {50, "Africa/Sao_Tome", "Sao Tome", "", "+00:00", 0},
-  {51, "Africa/Timbuktu", "Timbuktu", "", "+00:00", 0},
-  {52, "Africa/Tripoli", "Tripoli", "", "+02:00", 120},
-  {53, "Africa/Tunis", "Tunis", "", "+01:00", 60},
-  {54, "Africa/Windhoek", "Windhoek", "", "+02:00", 120},
-  {55, "America/Adak", "Adak", "", "-10:00", -600},
-  {56, "America/Anchorage", "Anchorage", "", "-09:00", -540},
-  {60, "America/Argentina/Buenos_Aires", "Buenos Aires", "", "-03:00", -180},
-  {76, "America/Atka", "Atka", "", "-10:00", -600},
-  {85, "America/Boise", "Boise", "", "-07:00", -420},
-  {94, "America/Chicago", "Chicago", "", "-06:00", -360},
-  {104, "America/Danmarkshavn", "Danmarkshavn", "", "+00:00", 0},
-  {107, "America/Denver", "Denver", "", "-07:00", -420},
-  {108, "America/Detroit", "Detroit", "", "-05:00", -300},
-  {110, "America/Edmonton", "Edmonton", "", "-07:00", -420},
-  {115, "America/Fort_Wayne", "Fort Wayne", "", "-05:00", -300},
-  {129, "America/Indiana/Indianapolis", "Indianapolis", "", "-05:00", -300},
-  {130, "America/Indiana/Knox", "Knox", "", "-06:00", -360},
-  {131, "America/Indiana/Marengo", "Marengo", "", "-05:00", -300},
-  {132, "America/Indiana/Petersburg", "Petersburg", "", "-05:00", -300},
-  {133, "America/Indiana/Tell_City", "Tell City", "", "-06:00", -360},
-  {134, "America/Indiana/Vevay", "Vevay", "", "-05:00", -300},
-  {135, "America/Indiana/Vincennes", "Vincennes", "", "-05:00", -300},
-  {136, "America/Indiana/Winamac", "Winamac", "", "-05:00", -300},
-  {142, "America/Juneau", "Juneau", "", "-09:00", -540},
-  {143, "America/Kentucky/Louisville", "Louisville", "", "-05:00", -300},
-  {144, "America/Kentucky/Monticello", "Monticello", "", "-05:00", -300},
-  {145, "America/Knox_IN", "Knox IN", "", "-06:00", -360},
-  {149, "America/Los_Angeles", "Los Angeles", "", "-08:00", -480},
-  {150, "America/Louisville", "Louisville", "", "-05:00", -300},
-  {160, "America/Menominee", "Menominee", "", "-06:00", -360},
-  {162, "America/Metlakatla", "Metlakatla", "", "-09:00", -540},
-  {163, "America/Mexico_City", "Mexico City", "", "-06:00", -360},
-  {168, "America/Montreal", "Montreal", "", "-05:00", -300},
-  {171, "America/New_York", "New York", "", "-05:00", -300},
-  {173, "America/Nome", "Nome", "", "-09:00", -540},
-  {175, "America/North_Dakota/Beulah", "Beulah", "", "-06:00", -360},
-  {176, "America/North_Dakota/Center", "Center", "", "-06:00", -360},
-  {177, "America/North_Dakota/New_Salem", "New Salem", "", "-06:00", -360},
-  {183, "America/Phoenix", "Phoenix", "", "-07:00", -420},
-  {193, "America/Regina", "Regina", "", "-06:00", -360},
-  {201, "America/Sao_Paulo", "Sao Paulo", "", "-03:00", -180},
-  {216, "America/Toronto", "Toronto", "", "-05:00", -300},
-  {221, "America/Winnipeg", "Winnipeg", "", "-06:00", -360},
-  {222, "America/Yakutat", "Yakutat", "", "-09:00", -540},
-  {224, "Antarctica/Casey", "Casey", "", "+08:00", 480},
-  {225, "Antarctica/Davis", "Davis", "", "+07:00", 420},
-  {226, "Antarctica/DumontDUrville", "DumontDUrville", "", "+10:00", 600},
-  {227, "Antarctica/Macquarie", "Macquarie", "", "+10:00", 600},
-  {228, "Antarctica/Mawson", "Mawson", "", "+05:00", 300},
-  {229, "Antarctica/McMurdo", "McMurdo", "", "+12:00", 720},
-  {232, "Antarctica/South_Pole", "South Pole", "", "+12:00", 720},
-  {233, "Antarctica/Syowa", "Syowa", "", "+03:00", 180},
-  {234, "Antarctica/Troll", "Troll", "", "+00:00", 0},
-  {235, "Antarctica/Vostok", "Vostok", "", "+05:00", 300},
-  {236, "Arctic/Longyearbyen", "Longyearbyen", "", "+01:00", 60},
-  {237, "Asia/Aden", "Aden", "", "+03:00", 180},
-  {238, "Asia/Almaty", "Almaty", "", "+05:00", 300},
-  {239, "Asia/Amman", "Amman", "", "+03:00", 180},
-  {240, "Asia/Anadyr", "Anadyr", "", "+12:00", 720},
-  {241, "Asia/Aqtau", "Aqtau", "", "+05:00", 300},
-  {242, "Asia/Aqtobe", "Aqtobe", "", "+05:00", 300},
-  {243, "Asia/Ashgabat", "Ashgabat", "", "+05:00", 300},
-  {244, "Asia/Ashkhabad", "Ashkhabad", "", "+05:00", 300},
-  {245, "Asia/Atyrau", "Atyrau", "", "+05:00", 300},
-  {246, "Asia/Baghdad", "Baghdad", "", "+03:00", 180},
-  {247, "Asia/Bahrain", "Bahrain", "", "+03:00", 180},
-  {248, "Asia/Baku", "Baku", "", "+04:00", 240},
-  {249, "Asia/Bangkok", "Bangkok", "", "+07:00", 420},
-  {250, "Asia/Barnaul", "Barnaul", "", "+07:00", 420},
-  {251, "Asia/Beirut", "Beirut", "", "+02:00", 120},
-  {252, "Asia/Bishkek", "Bishkek", "", "+06:00", 360},
-  {253, "Asia/Brunei", "Brunei", "", "+08:00", 480},
-  {254, "Asia/Calcutta", "Calcutta", "", "+05:30", 330},
-  {255, "Asia/Chita", "Chita", "", "+09:00", 540},
-  {256, "Asia/Choibalsan", "Choibalsan", "", "+08:00", 480},
-  {257, "Asia/Chongqing", "Chongqing", "", "+08:00", 480},
-  {258, "Asia/Chungking", "Chungking", "", "+08:00", 480},
-  {259, "Asia/Colombo", "Colombo", "", "+05:30", 330},
-  {260, "Asia/Dacca", "Dacca", "", "+06:00", 360},
-  {261, "Asia/Damascus", "Damascus", "", "+03:00", 180},
-  {262, "Asia/Dhaka", "Dhaka", "", "+06:00", 360},
-  {263, "Asia/Dili", "Dili", "", "+09:00", 540},
-  {264, "Asia/Dubai", "Dubai", "", "+04:00", 240},
-  {265, "Asia/Dushanbe", "Dushanbe", "", "+05:00", 300},
-  {266, "Asia/Famagusta", "Famagusta", "", "+02:00", 120},
-  {267, "Asia/Gaza", "Gaza", "", "+02:00", 120},
-  {268, "Asia/Harbin", "Harbin", "", "+08:00", 480},
-  {269, "Asia/Hebron", "Hebron", "", "+02:00", 120},
-  {270, "Asia/Ho_Chi_Minh", "Ho Chi Minh", "", "+07:00", 420},
-  {271, "Asia/Hong_Kong", "Hong Kong", "", "+08:00", 480},
-  {272, "Asia/Hovd", "Hovd", "", "+07:00", 420},
-  {273, "Asia/Irkutsk", "Irkutsk", "", "+08:00", 480},
-  {274, "Asia/Istanbul", "Istanbul", "", "+03:00", 180},
-  {275, "Asia/Jakarta", "Jakarta", "", "+07:00", 420},
-  {276, "Asia/Jayapura", "Jayapura", "", "+09:00", 540},
-  {277, "Asia/Jerusalem", "Jerusalem", "", "+02:00", 120},
-  {278, "Asia/Kabul", "Kabul", "", "+04:30", 270},
-  {279, "Asia/Kamchatka", "Kamchatka", "", "+12:00", 720},
-  {280, "Asia/Karachi", "Karachi", "", "+05:00", 300},
-  {281, "Asia/Kashgar", "Kashgar", "", "+06:00", 360},
-  {282, "Asia/Kathmandu", "Kathmandu", "", "+05:45", 345},
-  {283, "Asia/Katmandu", "Katmandu", "", "+05:45", 345},
-  {284, "Asia/Khandyga", "Khandyga", "", "+09:00", 540},
-  {285, "Asia/Kolkata", "Kolkata", "", "+05:30", 330},
-  {286, "Asia/Krasnoyarsk", "Krasnoyarsk", "", "+07:00", 420},
-  {287, "Asia/Kuala_Lumpur", "Kuala Lumpur", "", "+08:00", 480},
-  {288, "Asia/Kuching", "Kuching", "", "+08:00", 480},
-  {289, "Asia/Kuwait", "Kuwait", "", "+03:00", 180},
-  {290, "Asia/Macao", "Macao", "", "+08:00", 480},
-  {291, "Asia/Macau", "Macau", "", "+08:00", 480},
-  {292, "Asia/Magadan", "Magadan", "", "+11:00", 660},
-  {293, "Asia/Makassar", "Makassar", "", "+08:00", 480},
-  {294, "Asia/Manila", "Manila", "", "+08:00", 480},
-  {295, "Asia/Muscat", "Muscat", "", "+04:00", 240},
-  {296, "Asia/Nicosia", "Nicosia", "", "+02:00", 120},
-  {297, "Asia/Novokuznetsk", "Novokuznetsk", "", "+07:00", 420},
-  {298, "Asia/Novosibirsk", "Novosibirsk", "", "+07:00", 420},
-  {299, "Asia/Omsk", "Omsk", "", "+06:00", 360},
-  {300, "Asia/Oral", "Oral", "", "+05:00", 300},
-  {301, "Asia/Phnom_Penh", "Phnom Penh", "", "+07:00", 420},
-  {302, "Asia/Pontianak", "Pontianak", "", "+07:00", 420},
-  {303, "Asia/Pyongyang", "Pyongyang", "", "+09:00", 540},
-  {304, "Asia/Qatar", "Qatar", "", "+03:00", 180},
-  {305, "Asia/Qostanay", "Qostanay", "", "+05:00", 300},
-  {306, "Asia/Qyzylorda", "Qyzylorda", "", "+05:00", 300},
-  {307, "Asia/Rangoon", "Rangoon", "", "+06:30", 390},
-  {308, "Asia/Riyadh", "Riyadh", "", "+03:00", 180},
-  {309, "Asia/Saigon", "Saigon", "", "+07:00", 420},
-  {310, "Asia/Sakhalin", "Sakhalin", "", "+11:00", 660},
-  {311, "Asia/Samarkand", "Samarkand", "", "+05:00", 300},
-  {312, "Asia/Seoul", "Seoul", "", "+09:00", 540},
-  {313, "Asia/Shanghai", "Shanghai", "", "+08:00", 480},
-  {314, "Asia/Singapore", "Singapore", "", "+08:00", 480},
-  {315, "Asia/Srednekolymsk", "Srednekolymsk", "", "+11:00", 660},
-  {316, "Asia/Taipei", "Taipei", "", "+08:00", 480},
-  {317, "Asia/Tashkent", "Tashkent", "", "+05:00", 300},
-  {318, "Asia/Tbilisi", "Tbilisi", "", "+04:00", 240},
-  {319, "Asia/Tehran", "Tehran", "", "+03:30", 210},
-  {320, "Asia/Tel_Aviv", "Tel Aviv", "", "+02:00", 120},
-  {321, "Asia/Thimbu", "Thimbu", "", "+06:00", 360},
-  {322, "Asia/Thimphu", "Thimphu", "", "+06:00", 360},
-  {323, "Asia/Tokyo", "Tokyo", "", "+09:00", 540},
-  {324, "Asia/Tomsk", "Tomsk", "", "+07:00", 420},
-  {325, "Asia/Ujung_Pandang", "Ujung Pandang", "", "+08:00", 480},
-  {326, "Asia/Ulaanbaatar", "Ulaanbaatar", "", "+08:00", 480},
-  {327, "Asia/Ulan_Bator", "Ulan Bator", "", "+08:00", 480},
-  {328, "Asia/Urumqi", "Urumqi", "", "+06:00", 360},
-  {329, "Asia/Ust-Nera", "Ust-Nera", "", "+10:00", 600},
-  {330, "Asia/Vientiane", "Vientiane", "", "+07:00", 420},
-  {331, "Asia/Vladivostok", "Vladivostok", "", "+10:00", 600},
-  {332, "Asia/Yakutsk", "Yakutsk", "", "+09:00", 540},
-  {333, "Asia/Yangon", "Yangon", "", "+06:30", 390},
-  {334, "Asia/Yekaterinburg", "Yekaterinburg", "", "+05:00", 300},
-  {335, "Asia/Yerevan", "Yerevan", "", "+04:00", 240},
-  {336, "Atlantic/Azores", "Azores", "", "+00:00", 0},
-  {338, "Atlantic/Canary", "Canary", "", "+00:00", 0},
-  {340, "Atlantic/Faeroe", "Faeroe", "", "+00:00", 0},
-  {341, "Atlantic/Faroe", "Faroe", "", "+00:00", 0},
-  {342, "Atlantic/Jan_Mayen", "Jan Mayen", "", "+01:00", 60},
-  {343, "Atlantic/Madeira", "Madeira", "", "+00:00", 0},
-  {344, "Atlantic/Reykjavik", "Reykjavik", "", "+00:00", 0},
-  {346, "Atlantic/St_Helena", "St Helena", "", "+00:00", 0},
-  {348, "Australia/ACT", "ACT", "", "+10:00", 600},
-  {349, "Australia/Adelaide", "Adelaide", "", "+09:30", 570},
-  {350, "Australia/Brisbane", "Brisbane", "", "+10:00", 600},
-  {351, "Australia/Broken_Hill", "Broken Hill", "", "+09:30", 570},
-  {352, "Australia/Canberra", "Canberra", "", "+10:00", 600},
-  {353, "Australia/Currie", "Currie", "", "+10:00", 600},
-  {354, "Australia/Darwin", "Darwin", "", "+09:30", 570},
-  {355, "Australia/Eucla", "Eucla", "", "+08:45", 525},
-  {356, "Australia/Hobart", "Hobart", "", "+10:00", 600},
-  {357, "Australia/LHI", "LHI", "", "+10:30", 630},
-  {358, "Australia/Lindeman", "Lindeman", "", "+10:00", 600},
-  {359, "Australia/Lord_Howe", "Lord Howe", "", "+10:30", 630},
-  {360, "Australia/Melbourne", "Melbourne", "", "+10:00", 600},
-  {361, "Australia/North", "North", "", "+09:30", 570},
-  {362, "Australia/NSW", "NSW", "", "+10:00", 600},
-  {363, "Australia/Perth", "Perth", "", "+08:00", 480},
-  {364, "Australia/Queensland", "Queensland", "", "+10:00", 600},
-  {365, "Australia/South", "South", "", "+09:30", 570},
-  {366, "Australia/Sydney", "Sydney", "", "+10:00", 600},
-  {367, "Australia/Tasmania", "Tasmania", "", "+10:00", 600},
-  {368, "Australia/Victoria", "Victoria", "", "+10:00", 600},
-  {369, "Australia/West", "West", "", "+08:00", 480},
-  {370, "Australia/Yancowinna", "Yancowinna", "", "+09:30", 570},
-  {383, "Europe/Brussels", "Brussels", "", "+01:00", 60},
-  {386, "Europe/Athens", "Athens", "", "+02:00", 120},
-  {387, "Europe/Dublin", "Dublin", "", "+00:00", 0},
-  {388, "Etc/GMT", "GMT", "", "+00:00", 0},
-  {389, "Etc/GMT-0", "GMT-0", "", "+00:00", 0},
-  {390, "Etc/GMT-1", "GMT-1", "", "+01:00", 60},
-  {391, "Etc/GMT-10", "GMT-10", "", "+10:00", 600},
-  {392, "Etc/GMT-11", "GMT-11", "", "+11:00", 660},
-  {393, "Etc/GMT-12", "GMT-12", "", "+12:00", 720},
-  {394, "Etc/GMT-13", "GMT-13", "", "+13:00", 780},
-  {395, "Etc/GMT-14", "GMT-14", "", "+14:00", 840},
-  {396, "Etc/GMT-2", "GMT-2", "", "+02:00", 120},
-  {397, "Etc/GMT-3", "GMT-3", "", "+03:00", 180},
-  {398, "Etc/GMT-4", "GMT-4", "", "+04:00", 240},
-  {399, "Etc/GMT-5", "GMT-5", "", "+05:00", 300},
-  {400, "Etc/GMT-6", "GMT-6", "", "+06:00", 360},
-  {401, "Etc/GMT-7", "GMT-7", "", "+07:00", 420},
-  {402, "Etc/GMT-8", "GMT-8", "", "+08:00", 480},
-  {403, "Etc/GMT-9", "GMT-9", "", "+09:00", 540},
-  {404, "Etc/GMT0", "GMT0", "", "+00:00", 0},
-  {405, "Etc/Greenwich", "Greenwich", "", "+00:00", 0},
-  {406, "Etc/UCT", "UCT", "", "+00:00", 0},
-  {407, "Etc/Universal", "Universal", "", "+00:00", 0},
-  {408, "Etc/UTC", "UTC", "", "+00:00", 0},
-  {409, "Etc/Zulu", "Zulu", "", "+00:00", 0},
-  {410, "Europe/Amsterdam", "Amsterdam", "", "+01:00", 60},
-  {411, "Europe/Andorra", "Andorra", "", "+01:00", 60},
-  {412, "Europe/Astrakhan", "Astrakhan", "", "+04:00", 240},
-  {413, "Europe/Belfast", "Belfast", "", "+00:00", 0},
-  {414, "Europe/Belgrade", "Belgrade", "", "+01:00", 60},
-  {415, "Europe/Berlin", "Berlin", "", "+01:00", 60},
-  {416, "Europe/Bratislava", "Bratislava", "", "+01:00", 60},
-  {417, "Europe/Bucharest", "Bucharest", "", "+02:00", 120},
-  {418, "Europe/Budapest", "Budapest", "", "+01:00", 60},
-  {419, "Europe/Busingen", "Busingen", "", "+01:00", 60},
-  {420, "Europe/Chisinau", "Chisinau", "", "+02:00", 120},
-  {421, "Europe/Copenhagen", "Copenhagen", "", "+01:00", 60},
-  {422, "Europe/Gibraltar", "Gibraltar", "", "+01:00", 60},
-  {423, "Europe/Guernsey", "Guernsey", "", "+00:00", 0},
-  {424, "Europe/Helsinki", "Helsinki", "", "+02:00", 120},
-  {425, "Europe/Isle_of_Man", "Isle of Man", "", "+00:00", 0},
-  {426, "Europe/Istanbul", "Istanbul", "", "+03:00", 180},
-  {427, "Europe/Jersey", "Jersey", "", "+00:00", 0},
-  {428, "Europe/Kaliningrad", "Kaliningrad", "", "+02:00", 120},
-  {429, "Europe/Kiev", "Kiev", "", "+02:00", 120},
-  {430, "Europe/Kirov", "Kirov", "", "+03:00", 180},
-  {431, "Europe/Kyiv", "Kyiv", "", "+02:00", 120},
-  {432, "Europe/Lisbon", "Lisbon", "", "+00:00", 0},
-  {433, "Europe/Ljubljana", "Ljubljana", "", "+01:00", 60},
-  {434, "Europe/London", "London", "", "+00:00", 0},
-  {435, "Europe/Luxembourg", "Luxembourg", "", "+01:00", 60},
-  {436, "Europe/Madrid", "Madrid", "", "+01:00", 60},
-  {437, "Europe/Malta", "Malta", "", "+01:00", 60},
-  {438, "Europe/Mariehamn", "Mariehamn", "", "+02:00", 120},
-  {439, "Europe/Minsk", "Minsk", "", "+03:00", 180},
-  {440, "Europe/Monaco", "Monaco", "", "+01:00", 60},
-  {441, "Europe/Moscow", "Moscow", "", "+03:00", 180},
-  {442, "Europe/Nicosia", "Nicosia", "", "+02:00", 120},
-  {443, "Europe/Oslo", "Oslo", "", "+01:00", 60},
-  {444, "Europe/Paris", "Paris", "", "+01:00", 60},
-  {445, "Europe/Podgorica", "Podgorica", "", "+01:00", 60},
-  {446, "Europe/Prague", "Prague", "", "+01:00", 60},
-  {447, "Europe/Riga", "Riga", "", "+02:00", 120},
-  {448, "Europe/Rome", "Rome", "", "+01:00", 60},
-  {449, "Europe/Samara", "Samara", "", "+04:00", 240},
-  {450, "Europe/San_Marino", "San Marino", "", "+01:00", 60},
-  {451, "Europe/Sarajevo", "Sarajevo", "", "+01:00", 60},
-  {452, "Europe/Saratov", "Saratov", "", "+04:00", 240},
-  {453, "Europe/Simferopol", "Simferopol", "", "+03:00", 180},
-  {454, "Europe/Skopje", "Skopje", "", "+01:00", 60},
-  {455, "Europe/Sofia", "Sofia", "", "+02:00", 120},
-  {456, "Europe/Stockholm", "Stockholm", "", "+01:00", 60},
-  {457, "Europe/Tallinn", "Tallinn", "", "+02:00", 120},
-  {458, "Europe/Tirane", "Tirane", "", "+01:00", 60},
-  {459, "Europe/Tiraspol", "Tiraspol", "", "+02:00", 120},
-  {460, "Europe/Ulyanovsk", "Ulyanovsk", "", "+04:00", 240},
-  {461, "Europe/Uzhgorod", "Uzhgorod", "", "+02:00", 120},
-  {462, "Europe/Vaduz", "Vaduz", "", "+01:00", 60},
-  {463, "Europe/Vatican", "Vatican", "", "+01:00", 60},
-  {464, "Europe/Vienna", "Vienna", "", "+01:00", 60},
-  {465, "Europe/Vilnius", "Vilnius", "", "+02:00", 120},
-  {466, "Europe/Volgograd", "Volgograd", "", "+03:00", 180},
-  {467, "Europe/Warsaw", "Warsaw", "", "+01:00", 60},
-  {468, "Europe/Zagreb", "Zagreb", "", "+01:00", 60},
-  {469, "Europe/Zaporozhye", "Zaporozhye", "", "+02:00", 120},
-  {470, "Europe/Zurich", "Zurich", "", "+01:00", 60},
-  {471, "Pacific/Honolulu", "Honolulu", "", "-10:00", -600},
-  {472, "Indian/Antananarivo", "Antananarivo", "", "+03:00", 180},
-  {473, "Indian/Chagos", "Chagos", "", "+06:00", 360},
-  {474, "Indian/Christmas", "Christmas", "", "+07:00", 420},
-  {475, "Indian/Cocos", "Cocos", "", "+06:30", 390},
-  {476, "Indian/Comoro", "Comoro", "", "+03:00", 180},
-  {477, "Indian/Kerguelen", "Kerguelen", "", "+05:00", 300},
-  {478, "Indian/Mahe", "Mahe", "", "+04:00", 240},
-  {479, "Indian/Maldives", "Maldives", "", "+05:00", 300},
-  {480, "Indian/Mauritius", "Mauritius", "", "+04:00", 240},
-  {481, "Indian/Mayotte", "Mayotte", "", "+03:00", 180},
-  {482, "Indian/Reunion", "Reunion", "", "+04:00", 240},
-  {483, "Pacific/Kwajalein", "Kwajalein", "", "+12:00", 720},
-  {487, "Pacific/Auckland", "Auckland", "", "+12:00", 720},
-  {488, "Pacific/Chatham", "Chatham", "", "+12:45", 765},
-  {489, "Pacific/Apia", "Apia", "", "+13:00", 780},
-  {490, "Pacific/Bougainville", "Bougainville", "", "+11:00", 660},
-  {491, "Pacific/Chuuk", "Chuuk", "", "+10:00", 600},
-  {493, "Pacific/Efate", "Efate", "", "+11:00", 660},
-  {494, "Pacific/Enderbury", "Enderbury", "", "+13:00", 780},
-  {495, "Pacific/Fakaofo", "Fakaofo", "", "+13:00", 780},
-  {496, "Pacific/Fiji", "Fiji", "", "+12:00", 720},
-  {497, "Pacific/Funafuti", "Funafuti", "", "+12:00", 720},
-  {500, "Pacific/Guadalcanal", "Guadalcanal", "", "+11:00", 660},
-  {501, "Pacific/Guam", "Guam", "", "+10:00", 600},
-  {503, "Pacific/Kanton", "Kanton", "", "+13:00", 780},
-  {504, "Pacific/Kiritimati", "Kiritimati", "", "+14:00", 840},
-  {505, "Pacific/Kosrae", "Kosrae", "", "+11:00", 660},
-  {506, "Pacific/Majuro", "Majuro", "", "+12:00", 720},
-  {509, "Pacific/Nauru", "Nauru", "", "+12:00", 720},
-  {511, "Pacific/Norfolk", "Norfolk", "", "+11:00", 660},
-  {512, "Pacific/Noumea", "Noumea", "", "+11:00", 660},
-  {514, "Pacific/Palau", "Palau", "", "+09:00", 540},
-  {516, "Pacific/Pohnpei", "Pohnpei", "", "+11:00", 660},
-  {517, "Pacific/Ponape", "Ponape", "", "+11:00", 660},
-  {518, "Pacific/Port_Moresby", "Port Moresby", "", "+10:00", 600},
-  {520, "Pacific/Saipan", "Saipan", "", "+10:00", 600},
-  {523, "Pacific/Tarawa", "Tarawa", "", "+12:00", 720},
-  {524, "Pacific/Tongatapu", "Tongatapu", "", "+13:00", 780},
-  {525, "Pacific/Truk", "Truk", "", "+10:00", 600},
-  {526, "Pacific/Wake", "Wake", "", "+12:00", 720},
-  {527, "Pacific/Wallis", "Wallis", "", "+12:00", 720},
-  {528, "Pacific/Yap", "Yap", "", "+10:00", 600},
-  {529, "US/Alaska", "Alaska", "", "-09:00", -540},
-  {530, "US/Aleutian", "Aleutian", "", "-10:00", -600},
-  {531, "US/Arizona", "Arizona", "", "-07:00", -420},
-  {532, "US/Central", "Central", "", "-06:00", -360},
-  {534, "US/Eastern", "Eastern", "", "-05:00", -300},
-  {535, "US/Hawaii", "Hawaii", "", "-10:00", -600},
-  {536, "US/Indiana-Starke", "Indiana-Starke", "", "-06:00", -360},
-  {537, "US/Michigan", "Michigan", "", "-05:00", -300},
-  {538, "US/Mountain", "Mountain", "", "-07:00", -420},
-  {539, "US/Pacific", "Pacific", "", "-08:00", -480},
+// Minutes added to the zone's base offset from that instant on
+static const int16_t TZ_TRANSITION_DELTAS[TZ_TRANSITION_COUNT] = {
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+  120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0, 120, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60, 0, -60,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
+  30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30, 0, 30,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0,
+  60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60, 0, 60,
 };
 
 #endif // TIMEZONES_H
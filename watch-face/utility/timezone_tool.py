@@ -6,19 +6,44 @@ Utility to generate `src/shared/timezones.h` from the authoritative
 Usage:
   python3 utility/timezone_tool.py --gen
   python3 utility/timezone_tool.py --json path/to/timezones.json --out path/to/timezones.h
+  python3 utility/timezone_tool.py --gen --zoneinfo /usr/share/zoneinfo --from-year 2025 --to-year 2037
 
-This script treats the JSON file as the single source of truth and emits a C header
-containing a `SharedTimezone` array and `SHARED_TIMEZONE_COUNT`.
+This script treats the JSON file as the single source of truth and emits a C header,
+the `resources/data/timezones.bin` raw resource (`TIMEZONE_DB` in package.json) and
+`src/shared/timezones.bundle.js`, the minified zone list the phone side requires.
+The zone rows, identifiers and display names live in the resource and are read by the
+watch on demand; the header carries the counts, the resource layout (`TZ_DB_*`) and
+the DST transition tables. The "+05:30" offset string is not stored; the watch formats
+it from the offset.
+
+DST is taken from the machine's tzdata: each zone's TZif file (see `tzif.py`) is read
+offline and turned into a table of UTC transition instants for a window of years
+(`--from-year`/`--to-year`). Zones with identical schedules share one table, and each
+row carries the index of its table in `dst_rule`.
 """
 
 import argparse
+import calendar
 import json
 import os
+import struct
 import sys
+import zlib
+
+import tzif
 
 ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
 DEFAULT_JSON_PATH = os.path.join(ROOT, 'src', 'shared', 'timezones.canonical.json')
 DEFAULT_HEADER_PATH = os.path.join(ROOT, 'src', 'shared', 'timezones.h')
+DEFAULT_DB_PATH = os.path.join(ROOT, 'resources', 'data', 'timezones.bin')
+DEFAULT_BUNDLE_PATH = os.path.join(ROOT, 'src', 'shared', 'timezones.bundle.js')
+
+DEFAULT_ZONEINFO_DIR = tzif.DEFAULT_ZONEINFO_DIR
+
+# Window of years covered by the precompiled transition tables. Past the last year
+# the watch keeps the offset of the final transition, so regenerate before then.
+DEFAULT_FIRST_YEAR = 2025
+DEFAULT_LAST_YEAR = 2037
 
 
 def esc(s):
@@ -27,7 +52,142 @@ def esc(s):
     return s.replace('\\', '\\\\').replace('"', '\\"')
 
 
-def generate_header_from_json(json_path, out_path):
+def build_transition_rules(rows, zoneinfo_dir, first_year, last_year):
+    """
+    Read each zone's TZif file and return (rules, rule_ids).
+
+    A rule is a tuple of (utc_seconds, delta_minutes) entries: from `utc_seconds` on, the
+    zone's offset is its base `offset_minutes` plus `delta_minutes`. Zones with identical
+    schedules (aliases, or every EU zone) share one rule. Rule 0 is always "no change".
+    """
+    start = calendar.timegm((first_year, 1, 1, 0, 0, 0))
+    end = calendar.timegm((last_year + 1, 1, 1, 0, 0, 0))
+    rules = [()]
+    rule_ids = []
+    for row in rows:
+        try:
+            zone = tzif.load_zone(row['identifier'], zoneinfo_dir)
+        except (IOError, ValueError) as e:
+            print('No tzdata for %s (%s), assuming fixed offset' % (row['identifier'], e), file=sys.stderr)
+            rule_ids.append(0)
+            continue
+        base = row['offset_minutes']
+        entries = [(start, zone.offset_at(start) // 60 - base)]
+        entries += [(t, off // 60 - base) for t, off in zone.changes_between(start, end)]
+        # Before the first entry the delta is 0, so a leading 0 entry is redundant
+        if entries[0][1] == 0:
+            entries = entries[1:]
+        entries = tuple(entries)
+        if entries not in rules:
+            rules.append(entries)
+        rule_ids.append(rules.index(entries))
+    return rules, rule_ids
+
+
+def split_identifier(identifier):
+    """Split 'America/Argentina/Salta' into ('America/Argentina/', 'Salta')."""
+    cut = identifier.rfind('/') + 1
+    return identifier[:cut], identifier[cut:]
+
+
+def u16_offset(offset):
+    if offset > 0xFFFF:
+        print('String blob exceeds 64KB; 16-bit string offsets no longer fit', file=sys.stderr)
+        raise SystemExit(2)
+    return offset
+
+
+# Zone database resource layout. Every section is little-endian and its offset is
+# emitted into the header as TZ_DB_*_OFFSET:
+#   rows           SHARED_TIMEZONE_COUNT x TZ_DB_ROW_SIZE, in id order:
+#                  u16 id, s16 offset_minutes, u8 dst_rule, u8 prefix,
+#                  u16 name (string offset), u16 display name (string offset)
+#   by_identifier  SHARED_TIMEZONE_COUNT x u16 row, sorted by full identifier
+#   prefixes       TZ_PREFIX_COUNT x u16 string offset ("America/")
+#   strings        NUL-terminated strings, then TZ_DB_MAX_STRING zero bytes so
+#                  fixed-size string reads never run past the end
+DB_ROW_FORMAT = '<HhBBHH'
+
+
+def build_database(rows, rule_ids):
+    """
+    Pack the zone rows into the raw resource described above and return
+    (data, layout, prefix_count). Identifiers are stored as a shared region prefix
+    plus a name; identical strings (usually the display name and the name) are
+    stored once.
+    """
+    prefixes = sorted(set(split_identifier(r['identifier'])[0] for r in rows))
+    prefix_index = dict((p, i) for i, p in enumerate(prefixes))
+
+    strings = bytearray()
+    string_offsets = {}
+
+    def intern(text):
+        if text not in string_offsets:
+            string_offsets[text] = u16_offset(len(strings))
+            strings.extend(text.encode('utf-8') + b'\0')
+        return string_offsets[text]
+
+    prefix_offsets = [intern(p) for p in prefixes]
+    row_data = bytearray()
+    for row, rule_id in zip(rows, rule_ids):
+        prefix, name = split_identifier(row['identifier'])
+        row_data += struct.pack(DB_ROW_FORMAT, row['id'], row['offset_minutes'], rule_id,
+                                prefix_index[prefix], intern(name), intern(row['display_name']))
+
+    max_string = max(len(t.encode('utf-8')) for t in string_offsets) + 1
+    strings.extend(b'\0' * max_string)
+
+    # Row indices ordered by full identifier (byte order, matching strcmp)
+    by_identifier = sorted(range(len(rows)), key=lambda i: rows[i]['identifier'].encode('utf-8'))
+
+    layout = {'ROW_SIZE': struct.calcsize(DB_ROW_FORMAT), 'MAX_STRING': max_string}
+    data = bytearray()
+    for section, payload in (('ROWS', row_data),
+                             ('BY_IDENTIFIER', struct.pack('<%dH' % len(rows), *by_identifier)),
+                             ('PREFIXES', struct.pack('<%dH' % len(prefixes), *prefix_offsets)),
+                             ('STRINGS', strings)):
+        layout[section + '_OFFSET'] = len(data)
+        data += payload
+    layout['SIZE'] = len(data)
+    return bytes(data), layout, len(prefixes)
+
+
+def build_pkjs_bundle(rows):
+    """
+    Return the source of the pkjs zone bundle: two parallel columns, ready to use.
+
+    `zones` is the config page picker's list (see src/pkjs/picker.js), grouped by region
+    as "Africa*Abidjan~0!Accra~0!....America*Adak~-600!..." with offsets in minutes; its
+    separators are characters encodeURIComponent leaves alone, so it costs about its
+    own length in the config URL. `ids` holds the zone id of each entry, in the same
+    order. Zones without an offset string are left out, as before. `hash`, a CRC-32 of
+    both, keys the phone's cache of the generated config page.
+    """
+    regions = {}
+    for row in sorted(rows, key=lambda r: r['identifier']):
+        if not row['offset_str']:
+            continue
+        region, slash, city = row['identifier'].partition('/')
+        if not slash:
+            region, city = '', region
+        regions.setdefault(region, []).append((city, row))
+    zones = []
+    ids = []
+    for region in sorted(regions):
+        zones.append('%s*%s' % (region, '!'.join('%s~%d' % (city, row['offset_minutes'])
+                                                  for city, row in regions[region])))
+        ids.extend(row['id'] for _, row in regions[region])
+    zones = '.'.join(zones)
+    digest = zlib.crc32(json.dumps([zones, ids], separators=(',', ':')).encode('utf-8'))
+    bundle = json.dumps({'zones': zones, 'ids': ids, 'hash': '%08x' % digest}, separators=(',', ':'))
+    return ('// Generated by utility/timezone_tool.py from timezones.canonical.json; do not edit\n'
+            'module.exports=%s;\n' % bundle)
+
+
+def generate_header_from_json(json_path, out_path, db_path=DEFAULT_DB_PATH, zoneinfo_dir=DEFAULT_ZONEINFO_DIR,
+                              first_year=DEFAULT_FIRST_YEAR, last_year=DEFAULT_LAST_YEAR,
+                              bundle_path=DEFAULT_BUNDLE_PATH):
     if not os.path.exists(json_path):
         print('JSON not found at', json_path, file=sys.stderr)
         raise SystemExit(2)
@@ -44,30 +204,9 @@ def generate_header_from_json(json_path, out_path):
     except Exception:
         tzs_sorted = tzs
 
-    count = len(tzs_sorted)
-    lines = []
-    lines.append('#ifndef TIMEZONES_H')
-    lines.append('#define TIMEZONES_H')
-    lines.append('')
-    lines.append('#define SHARED_TIMEZONE_COUNT %d' % count)
-    lines.append('')
-    lines.append('typedef struct {')
-    lines.append('  int id;')
-    lines.append('  const char *identifier;')
-    lines.append('  const char *display_name;')
-    lines.append('  const char *abbreviation;')
-    lines.append('  const char *offset_str;')
-    lines.append('  int offset_minutes;')
-    lines.append('} SharedTimezone;')
-    lines.append('')
-    lines.append('static const SharedTimezone SHARED_TIMEZONES[SHARED_TIMEZONE_COUNT] = {')
-
     # Assign deterministic IDs: prefer existing 'id' in JSON, otherwise use the 1-based index
+    rows = []
     for idx, t in enumerate(tzs_sorted, start=1):
-        identifier = esc(t.get('identifier', ''))
-        display = esc(t.get('display_name', t.get('identifier', '')))
-        abbr = esc(t.get('abbreviation_sdt', t.get('abbreviation', '')))
-        off_str = esc(t.get('offset_sdt', t.get('offset_str', '')))
         try:
             # Try to get offset_minutes first, then convert offset_hours to minutes
             off_min = int(t.get('offset_minutes', 0))
@@ -80,10 +219,64 @@ def generate_header_from_json(json_path, out_path):
             tid = int(t.get('id')) if ('id' in t and str(t.get('id')).isdigit()) else idx
         except Exception:
             tid = idx
-        line = '  {%d, "%s", "%s", "%s", "%s", %d},' % (
-            tid, identifier, display, abbr, off_str, off_min)
-        lines.append(line)
+        rows.append({
+            'id': tid,
+            'identifier': t.get('identifier', ''),
+            'display_name': t.get('display_name', t.get('identifier', '')),
+            'offset_minutes': off_min,
+            'offset_str': t.get('offset_str', ''),
+        })
+
+    rules, rule_ids = build_transition_rules(rows, zoneinfo_dir, first_year, last_year)
+    transition_count = sum(len(r) for r in rules)
+    db, layout, prefix_count = build_database(rows, rule_ids)
 
+    count = len(rows)
+    lines = []
+    lines.append('#ifndef TIMEZONES_H')
+    lines.append('#define TIMEZONES_H')
+    lines.append('')
+    lines.append('#include <stdint.h>')
+    lines.append('')
+    lines.append('#define SHARED_TIMEZONE_COUNT %d' % count)
+    lines.append('')
+    lines.append('// Transition tables generated from tzdata for %d..%d' % (first_year, last_year))
+    lines.append('#define TZ_TRANSITION_FIRST_YEAR %d' % first_year)
+    lines.append('#define TZ_TRANSITION_LAST_YEAR %d' % last_year)
+    lines.append('#define TZ_RULE_COUNT %d' % len(rules))
+    lines.append('#define TZ_TRANSITION_COUNT %d' % transition_count)
+    lines.append('#define DST_RULE_NONE 0')
+    lines.append('#define TZ_PREFIX_COUNT %d' % prefix_count)
+    lines.append('')
+    lines.append('// Layout of the TIMEZONE_DB raw resource (%s)' % os.path.relpath(db_path, ROOT))
+    for key in ('ROW_SIZE', 'MAX_STRING', 'ROWS_OFFSET', 'BY_IDENTIFIER_OFFSET', 'PREFIXES_OFFSET',
+                'STRINGS_OFFSET', 'SIZE'):
+        lines.append('#define TZ_DB_%s %d' % (key, layout[key]))
+    lines.append('')
+    lines.append('typedef struct {')
+    lines.append('  uint16_t start;  // first entry in TZ_TRANSITION_TIMES / TZ_TRANSITION_DELTAS')
+    lines.append('  uint16_t count;')
+    lines.append('} TzRule;')
+    lines.append('')
+    lines.append('static const TzRule TZ_RULES[TZ_RULE_COUNT] = {')
+    start = 0
+    for rule_id, rule in enumerate(rules):
+        users = [rows[i]['identifier'] for i, r in enumerate(rule_ids) if r == rule_id]
+        note = 'no transitions' if rule_id == 0 else '%s (%d zone%s)' % (users[0], len(users), '' if len(users) == 1 else 's')
+        lines.append('  {%d, %d},  // %d: %s' % (start, len(rule), rule_id, note))
+        start += len(rule)
+    lines.append('};')
+    lines.append('')
+    lines.append('// UTC instant of each transition, sorted within a rule')
+    lines.append('static const int32_t TZ_TRANSITION_TIMES[TZ_TRANSITION_COUNT] = {')
+    for rule in rules[1:]:
+        lines.append('  ' + ', '.join('%d' % t for t, _ in rule) + ',')
+    lines.append('};')
+    lines.append('')
+    lines.append('// Minutes added to the zone\'s base offset from that instant on')
+    lines.append('static const int16_t TZ_TRANSITION_DELTAS[TZ_TRANSITION_COUNT] = {')
+    for rule in rules[1:]:
+        lines.append('  ' + ', '.join('%d' % d for _, d in rule) + ',')
     lines.append('};')
     lines.append('')
     lines.append('#endif // TIMEZONES_H')
@@ -93,11 +286,26 @@ def generate_header_from_json(json_path, out_path):
         f.write('\n'.join(lines) + '\n')
     print('Wrote', out_path)
 
+    os.makedirs(os.path.dirname(db_path), exist_ok=True)
+    with open(db_path, 'wb') as f:
+        f.write(db)
+    print('Wrote', db_path, '(%d bytes)' % len(db))
+
+    os.makedirs(os.path.dirname(bundle_path), exist_ok=True)
+    with open(bundle_path, 'w', encoding='utf-8') as f:
+        f.write(build_pkjs_bundle(rows))
+    print('Wrote', bundle_path)
+
 
 def main():
     parser = argparse.ArgumentParser(description='Generate timezones.h from timezones.json')
     parser.add_argument('--json', default=DEFAULT_JSON_PATH, help='Path to timezones.json (default: %(default)s)')
     parser.add_argument('--out', default=DEFAULT_HEADER_PATH, help='Output header path (default: %(default)s)')
+    parser.add_argument('--db', default=DEFAULT_DB_PATH, help='Output zone database resource (default: %(default)s)')
+    parser.add_argument('--bundle', default=DEFAULT_BUNDLE_PATH, help='Output pkjs zone bundle (default: %(default)s)')
+    parser.add_argument('--zoneinfo', default=DEFAULT_ZONEINFO_DIR, help='tzdata directory with TZif files (default: %(default)s)')
+    parser.add_argument('--from-year', type=int, default=DEFAULT_FIRST_YEAR, help='First year of transition tables (default: %(default)s)')
+    parser.add_argument('--to-year', type=int, default=DEFAULT_LAST_YEAR, help='Last year of transition tables (default: %(default)s)')
     parser.add_argument('--gen', action='store_true', help='Generate header from JSON')
     args = parser.parse_args()
 
@@ -105,7 +313,8 @@ def main():
         parser.print_help()
         return
 
-    generate_header_from_json(args.json, args.out)
+    generate_header_from_json(args.json, args.out, args.db, args.zoneinfo, args.from_year, args.to_year,
+                              args.bundle)
 
 
 if __name__ == '__main__':
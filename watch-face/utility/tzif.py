@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""
+Minimal reader for the TZif files shipped in `/usr/share/zoneinfo`.
+
+Only what `timezone_tool.py` needs is implemented: the 64-bit (v2+) transition data
+and the POSIX TZ footer, which slim tzdata builds rely on for dates past the last
+explicit transition.
+
+Usage:
+  python3 utility/tzif.py Europe/London 2025 2026
+"""
+
+import calendar
+import os
+import re
+import struct
+import sys
+import time
+
+DEFAULT_ZONEINFO_DIR = '/usr/share/zoneinfo'
+
+
+class TzifZone(object):
+    def __init__(self, transitions, initial_offset, footer):
+        # transitions: sorted list of (utc_seconds, utoff_seconds)
+        self.transitions = transitions
+        self.initial_offset = initial_offset
+        self.footer = parse_posix_tz(footer) if footer else None
+
+    def offset_at(self, utc):
+        """UTC offset in seconds in effect at `utc`."""
+        if self.transitions and utc >= self.transitions[-1][0] and self.footer:
+            return self.footer.offset_at(utc)
+        offset = self.initial_offset
+        for t, off in self.transitions:
+            if t > utc:
+                break
+            offset = off
+        return offset
+
+    def changes_between(self, start, end):
+        """List of (utc, utoff) for every offset change in [start, end)."""
+        changes = []
+        current = self.offset_at(start - 1)
+        explicit = [(t, off) for t, off in self.transitions if start <= t < end]
+        last_explicit = self.transitions[-1][0] if self.transitions else None
+        candidates = list(explicit)
+        if self.footer:
+            first_year = time_year(max(start, last_explicit or start))
+            for year in range(first_year, time_year(end) + 1):
+                for t, off in self.footer.transitions_in_year(year):
+                    if start <= t < end and (last_explicit is None or t > last_explicit):
+                        candidates.append((t, off))
+        for t, off in sorted(candidates):
+            if off != current:
+                changes.append((t, off))
+                current = off
+        return changes
+
+
+def time_year(utc):
+    return time.gmtime(utc).tm_year
+
+
+def read_tzif(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'TZif':
+        raise ValueError('%s is not a TZif file' % path)
+
+    def header(buf, pos):
+        version = buf[pos + 4:pos + 5]
+        counts = struct.unpack('>6l', buf[pos + 20:pos + 44])
+        return version, counts
+
+    version, counts = header(data, 0)
+    isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = counts
+    pos = 44
+    time_size = 4
+    if version >= b'2':
+        # Skip the v1 block and use the 64-bit one that follows it
+        pos += timecnt * 4 + timecnt + typecnt * 6 + charcnt + leapcnt * 8 + isstdcnt + isutcnt
+        version, counts = header(data, pos)
+        isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = counts
+        pos += 44
+        time_size = 8
+
+    fmt = '>%d%s' % (timecnt, 'q' if time_size == 8 else 'l')
+    times = struct.unpack(fmt, data[pos:pos + timecnt * time_size])
+    pos += timecnt * time_size
+    indices = data[pos:pos + timecnt]
+    pos += timecnt
+    types = []
+    for i in range(typecnt):
+        utoff, isdst, _abbrind = struct.unpack('>lBB', data[pos + i * 6:pos + i * 6 + 6])
+        types.append(utoff)
+    pos += typecnt * 6 + charcnt + leapcnt * (time_size + 4) + isstdcnt + isutcnt
+
+    footer = ''
+    if time_size == 8 and data[pos:pos + 1] == b'\n':
+        end = data.index(b'\n', pos + 1)
+        footer = data[pos + 1:end].decode('ascii')
+
+    transitions = [(t, types[idx]) for t, idx in zip(times, indices)]
+    initial_offset = types[0] if types else 0
+    return TzifZone(transitions, initial_offset, footer)
+
+
+def load_zone(identifier, zoneinfo_dir=DEFAULT_ZONEINFO_DIR):
+    return read_tzif(os.path.join(zoneinfo_dir, identifier))
+
+
+# --- POSIX TZ footer -------------------------------------------------------
+
+_NAME = r'(?:<[^>]+>|[A-Za-z]{3,})'
+_OFFSET = r'[+-]?\d{1,3}(?::\d{2}){0,2}'
+_POSIX_RE = re.compile(r'^(%s)(%s)(?:(%s)(%s)?(?:,([^,]+),([^,]+))?)?$' % (_NAME, _OFFSET, _NAME, _OFFSET))
+
+
+def _parse_hms(s):
+    sign = -1 if s.startswith('-') else 1
+    parts = [int(p) for p in s.lstrip('+-').split(':')]
+    while len(parts) < 3:
+        parts.append(0)
+    return sign * (parts[0] * 3600 + parts[1] * 60 + parts[2])
+
+
+class PosixTz(object):
+    def __init__(self, std_offset, dst_offset, start, end):
+        self.std_offset = std_offset
+        self.dst_offset = dst_offset
+        self.start = start
+        self.end = end
+
+    def transitions_in_year(self, year):
+        """(utc, utoff) pairs for the DST start and end in `year`, if any."""
+        if self.dst_offset is None:
+            return []
+        # Rule times are local wall-clock time in the offset in effect before the change
+        start = _rule_day_seconds(self.start[0], year) + self.start[1] - self.std_offset
+        end = _rule_day_seconds(self.end[0], year) + self.end[1] - self.dst_offset
+        return sorted([(start, self.dst_offset), (end, self.std_offset)])
+
+    def offset_at(self, utc):
+        if self.dst_offset is None:
+            return self.std_offset
+        year = time.gmtime(utc).tm_year
+        offset = self.std_offset
+        # The previous year's last change decides the offset at the start of this one
+        for t, off in self.transitions_in_year(year - 1) + self.transitions_in_year(year):
+            if t <= utc:
+                offset = off
+        return offset
+
+
+def _rule_day_seconds(rule, year):
+    """UTC seconds of local midnight (as if at UTC) for a POSIX date rule in `year`."""
+    jan1 = calendar.timegm((year, 1, 1, 0, 0, 0))
+    if rule.startswith('M'):
+        month, week, wday = [int(x) for x in rule[1:].split('.')]
+        first_wday = (calendar.weekday(year, month, 1) + 1) % 7  # 0 = Sunday
+        day = 1 + (wday - first_wday) % 7 + (week - 1) * 7
+        days_in_month = calendar.monthrange(year, month)[1]
+        while day > days_in_month:
+            day -= 7
+        return calendar.timegm((year, month, day, 0, 0, 0))
+    if rule.startswith('J'):
+        n = int(rule[1:])
+        # Jn counts 1..365 and never includes Feb 29
+        if calendar.isleap(year) and n >= 60:
+            n += 1
+        return jan1 + (n - 1) * 86400
+    return jan1 + int(rule) * 86400
+
+
+def parse_posix_tz(spec):
+    m = _POSIX_RE.match(spec)
+    if not m:
+        raise ValueError('Unsupported POSIX TZ string: %r' % spec)
+    _std, std_off, dst, dst_off, start, end = m.groups()
+    # POSIX offsets are west-positive; TZif offsets are east-positive
+    std_offset = -_parse_hms(std_off)
+    if not dst:
+        return PosixTz(std_offset, None, None, None)
+    dst_offset = -_parse_hms(dst_off) if dst_off else std_offset + 3600
+
+    def rule(part):
+        date, _, t = part.partition('/')
+        return date, (_parse_hms(t) if t else 7200)
+
+    if not start:
+        # Default US rules, as documented for POSIX TZ without a rule part
+        start, end = 'M3.2.0', 'M11.1.0'
+    return PosixTz(std_offset, dst_offset, rule(start), rule(end))
+
+
+def main():
+    if len(sys.argv) != 4:
+        print(__doc__.strip().splitlines()[-1].strip(), file=sys.stderr)
+        raise SystemExit(2)
+    zone = load_zone(sys.argv[1])
+    start = calendar.timegm((int(sys.argv[2]), 1, 1, 0, 0, 0))
+    end = calendar.timegm((int(sys.argv[3]) + 1, 1, 1, 0, 0, 0))
+    print('offset at start: %+d min' % (zone.offset_at(start) // 60))
+    for t, off in zone.changes_between(start, end):
+        print('%s UTC -> %+d min' % (time.strftime('%Y-%m-%d %H:%M', time.gmtime(t)), off // 60))
+
+
+if __name__ == '__main__':
+    main()